@@ -446,3 +446,111 @@ bool HashMap__remove(
     this->size--;
     return true;
 }
+
+
+/// # Arena
+struct Arena__Block__TAG {
+    Arena__Block* next;
+    size_t capacity;
+    size_t size;
+    max_align_t data[];
+};
+
+/// ## Arena static functions
+static inline size_t Arena__align(
+    const size_t size
+) {
+    const size_t alignment = sizeof(max_align_t);
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+static Arena__Block* Arena__Block__new(
+    const size_t capacity
+) {
+    Arena__Block* const this = (Arena__Block*) MALLOC(
+        sizeof(Arena__Block) + capacity
+    );
+    if (!this) {return NULL;}
+
+    this->next     = NULL;
+    this->capacity = capacity;
+    this->size     = 0;
+
+    return this;
+}
+
+/// ## Arena methods
+Arena* Arena__new(
+    const size_t blockSize
+) {
+    Arena* const this = (Arena*) MALLOC(sizeof(Arena));
+    if (!this) {goto error;}
+
+    this->blockSize = Arena__align(blockSize);
+    this->first     = NULL;
+    this->current   = NULL;
+
+    this->first = Arena__Block__new(this->blockSize);
+    if (!(this->first)) {goto error;}
+
+    this->current = this->first;
+
+    return this;
+
+error:
+
+    if (this) {
+        FREE(this);
+    }
+
+    return NULL;
+}
+
+void Arena__delete(
+    Arena* const this
+) {
+    Arena__Block* block = this->first;
+    while (block) {
+        Arena__Block* const next = block->next;
+        FREE(block);
+        block = next;
+    }
+
+    FREE(this);
+}
+
+void* Arena__allocate(
+    Arena* const this,
+    const size_t size
+) {
+    const size_t alignedSize = Arena__align(size);
+
+    // Skip to the next (cleared) block, or append a new block
+    while ((this->current->size + alignedSize) > (this->current->capacity)) {
+        if (!(this->current->next)) {
+            Arena__Block* const block = Arena__Block__new(
+                (alignedSize > (this->blockSize)) ? alignedSize : this->blockSize
+            );
+            if (!block) {return NULL;}
+
+            this->current->next = block;
+        }
+
+        this->current = this->current->next;
+    }
+
+    void* const allocated = (char*) this->current->data + this->current->size;
+    this->current->size += alignedSize;
+
+    return allocated;
+}
+
+void Arena__clear(
+    Arena* const this
+) {
+    for (Arena__Block* block = this->first ; block ; block = block->next) {
+        block->size = 0;
+    }
+
+    this->current = this->first;
+}
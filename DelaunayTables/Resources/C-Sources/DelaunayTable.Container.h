@@ -144,3 +144,37 @@ extern bool HashMap__remove(
     Object__equal  key_equality,
     Object__delete value_delete
 );
+
+
+/** # Arena
+ * bump allocator which serves objects from large blocks
+ * - Objects are not freed one by one.
+ * - All objects are freed at once by `Arena__delete`,
+ *   or invalidated by `Arena__clear` to reuse the blocks.
+ */
+typedef struct Arena__Block__TAG Arena__Block;
+
+typedef struct {
+    size_t blockSize;
+    Arena__Block* first;
+    Arena__Block* current;
+} Arena;
+
+/// ## Arena methods
+extern Arena* Arena__new(
+    const size_t blockSize
+);
+
+extern void Arena__delete(
+    Arena* this
+);
+
+/// Allocated memory is aligned for any type, and not initialized
+extern void* Arena__allocate(
+    Arena* this,
+    const size_t size
+);
+
+extern void Arena__clear(
+    Arena* this
+);
@@ -0,0 +1,275 @@
+#include "DelaunayTable.FaceHashMap.h"
+
+#include <string.h>
+
+
+/// # FaceHashMap static functions
+static const size_t FaceHashMap__initialCapacity = 16;
+
+/// Maximum load factor is `FaceHashMap__loadNumerator / 8`
+static const size_t FaceHashMap__loadNumerator = 7;
+
+/// Finalizer of splitmix64, every input bit affects every output bit
+static inline uint64_t FaceHashMap__mix(
+    uint64_t x
+) {
+    x ^= x >> 30; x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27; x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return x;
+}
+
+static inline bool FaceHashMap__equal(
+    const size_t nIndices,
+    const size_t* const face0,
+    const size_t* const face1
+) {
+    for (size_t i = 0 ; i < nIndices ; i++) {
+        if (face0[i] != face1[i]) {return false;}
+    }
+    return true;
+}
+
+static inline size_t* FaceHashMap__face(
+    const FaceHashMap* const this,
+    const size_t slot
+) {
+    return this->faces + slot * (this->nIndices);
+}
+
+/// Slot of `face`, or `capacity` if not found
+static size_t FaceHashMap__find(
+    const FaceHashMap* const this,
+    const size_t* const face
+) {
+    const size_t mask = this->capacity - 1;
+
+    size_t slot = FaceHashMap__hash(this->nIndices, face) & mask;
+
+    for (uint32_t distance = 1 ; ; distance++) {
+        // Robin Hood invariant: `face` would have displaced a closer entry
+        if (this->distances[slot] < distance) {return this->capacity;}
+
+        if (
+            this->distances[slot] == distance &&
+            FaceHashMap__equal(this->nIndices, FaceHashMap__face(this, slot), face)
+        ) {
+            return slot;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+}
+
+/// Insert `face` which is not in `this`, capacity must be enough
+static void FaceHashMap__insert(
+    FaceHashMap* const this,
+    const size_t* const face,
+    const size_t value
+) {
+    const size_t nIndices = this->nIndices;
+    const size_t mask     = this->capacity - 1;
+
+    size_t* carriedFace = this->swap;
+    size_t* bufferFace  = this->swap + nIndices;
+    size_t carriedValue = value;
+
+    memcpy(carriedFace, face, nIndices * sizeof(size_t));
+
+    size_t slot = FaceHashMap__hash(nIndices, carriedFace) & mask;
+
+    for (uint32_t distance = 1 ; ; distance++) {
+        if (this->distances[slot] == 0) {
+            memcpy(FaceHashMap__face(this, slot), carriedFace, nIndices * sizeof(size_t));
+            this->values   [slot] = carriedValue;
+            this->distances[slot] = distance;
+            return;
+        }
+
+        // Take the slot from the entry closer to its home
+        if (this->distances[slot] < distance) {
+            memcpy(bufferFace, FaceHashMap__face(this, slot), nIndices * sizeof(size_t));
+            memcpy(FaceHashMap__face(this, slot), carriedFace, nIndices * sizeof(size_t));
+
+            size_t* const swapped = carriedFace;
+            carriedFace = bufferFace;
+            bufferFace  = swapped;
+
+            const size_t   value_    = this->values   [slot];
+            const uint32_t distance_ = this->distances[slot];
+            this->values   [slot] = carriedValue;
+            this->distances[slot] = distance;
+            carriedValue = value_;
+            distance     = distance_;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+}
+
+static int FaceHashMap__reserve(
+    FaceHashMap* const this,
+    const size_t capacity
+) {
+    const size_t nIndices = this->nIndices;
+
+    size_t*   const faces     = (size_t*)   MALLOC(capacity * nIndices * sizeof(size_t));
+    size_t*   const values    = (size_t*)   MALLOC(capacity * sizeof(size_t));
+    uint32_t* const distances = (uint32_t*) CALLOC(capacity, sizeof(uint32_t));
+
+    if (!faces || !values || !distances) {
+        if (faces)     {FREE(faces);}
+        if (values)    {FREE(values);}
+        if (distances) {FREE(distances);}
+        return FAILURE;
+    }
+
+    size_t*   const oldFaces     = this->faces;
+    size_t*   const oldValues    = this->values;
+    uint32_t* const oldDistances = this->distances;
+    const size_t    oldCapacity  = this->capacity;
+
+    this->capacity  = capacity;
+    this->faces     = faces;
+    this->values    = values;
+    this->distances = distances;
+
+    for (size_t slot = 0 ; slot < oldCapacity ; slot++) {
+        if (oldDistances[slot] == 0) {continue;}
+
+        FaceHashMap__insert(
+            this,
+            oldFaces + slot * nIndices,
+            oldValues[slot]
+        );
+    }
+
+    if (oldFaces)     {FREE(oldFaces);}
+    if (oldValues)    {FREE(oldValues);}
+    if (oldDistances) {FREE(oldDistances);}
+
+    return SUCCESS;
+}
+
+
+/// # FaceHashMap methods
+size_t FaceHashMap__hash(
+    const size_t nIndices,
+    const size_t* const face
+) {
+    uint64_t hash = (uint64_t) nIndices;
+    for (size_t i = 0 ; i < nIndices ; i++) {
+        hash = FaceHashMap__mix(hash ^ (uint64_t) face[i]);
+    }
+    return (size_t) hash;
+}
+
+FaceHashMap* FaceHashMap__new(
+    const size_t nIndices
+) {
+    FaceHashMap* const this = (FaceHashMap*) MALLOC(sizeof(FaceHashMap));
+    if (!this) {goto error;}
+
+    this->nIndices  = nIndices;
+    this->size      = 0;
+    this->capacity  = 0;
+    this->faces     = NULL;
+    this->values    = NULL;
+    this->distances = NULL;
+    this->swap      = NULL;
+
+    this->swap = (size_t*) MALLOC(2 * nIndices * sizeof(size_t));
+    if (!(this->swap)) {goto error;}
+
+    if (FaceHashMap__reserve(this, FaceHashMap__initialCapacity)) {goto error;}
+
+    return this;
+
+error:
+
+    if (this) {
+        if (this->swap) {FREE(this->swap);}
+        FREE(this);
+    }
+
+    return NULL;
+}
+
+void FaceHashMap__delete(
+    FaceHashMap* const this
+) {
+    FREE(this->faces);
+    FREE(this->values);
+    FREE(this->distances);
+    FREE(this->swap);
+    FREE(this);
+}
+
+void FaceHashMap__clear(
+    FaceHashMap* const this
+) {
+    memset(this->distances, 0, this->capacity * sizeof(uint32_t));
+    this->size = 0;
+}
+
+bool FaceHashMap__get(
+    const FaceHashMap* const this,
+    const size_t* const face,
+    size_t* const value
+) {
+    const size_t slot = FaceHashMap__find(this, face);
+    if (slot == this->capacity) {return false;}
+
+    *value = this->values[slot];
+    return true;
+}
+
+int FaceHashMap__set(
+    FaceHashMap* const this,
+    const size_t* const face,
+    const size_t value
+) {
+    const size_t slot = FaceHashMap__find(this, face);
+    if (slot < this->capacity) {
+        this->values[slot] = value;
+        return SUCCESS;
+    }
+
+    if ((this->size + 1) * 8 > (this->capacity) * FaceHashMap__loadNumerator) {
+        if (FaceHashMap__reserve(this, this->capacity * 2)) {return FAILURE;}
+    }
+
+    FaceHashMap__insert(this, face, value);
+    this->size++;
+
+    return SUCCESS;
+}
+
+bool FaceHashMap__remove(
+    FaceHashMap* const this,
+    const size_t* const face
+) {
+    const size_t mask = this->capacity - 1;
+
+    size_t slot = FaceHashMap__find(this, face);
+    if (slot == this->capacity) {return false;}
+
+    // Backward shift deletion, no tombstone is left
+    size_t next = (slot + 1) & mask;
+    while (this->distances[next] > 1) {
+        memcpy(
+            FaceHashMap__face(this, slot),
+            FaceHashMap__face(this, next),
+            (this->nIndices) * sizeof(size_t)
+        );
+        this->values   [slot] = this->values   [next];
+        this->distances[slot] = this->distances[next] - 1;
+
+        slot = next;
+        next = (next + 1) & mask;
+    }
+    this->distances[slot] = 0;
+
+    this->size--;
+    return true;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "DelaunayTable.Common.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/** # FaceHashMap
+ * open-addressing hash map {face => polygon index}
+ * - A face is `nIndices` sorted vertex indices, stored inline in `faces`.
+ * - Capacity is a power of two, collisions are resolved by Robin Hood probing.
+ * - `distances[i]` is 1 + probe distance of the slot, 0 if the slot is empty.
+ */
+typedef struct {
+    size_t nIndices;
+    size_t size;
+    size_t capacity;
+    size_t* faces;       /// size_t[capacity][nIndices]
+    size_t* values;      /// size_t[capacity]
+    uint32_t* distances; /// uint32_t[capacity]
+    size_t* swap;        /// size_t[2][nIndices], faces carried while inserting
+} FaceHashMap;
+
+/// ## FaceHashMap methods
+extern FaceHashMap* FaceHashMap__new(
+    const size_t nIndices
+);
+
+extern void FaceHashMap__delete(
+    FaceHashMap* this
+);
+
+extern void FaceHashMap__clear(
+    FaceHashMap* this
+);
+
+extern bool FaceHashMap__get(
+    const FaceHashMap* this,
+    const size_t* face,
+    size_t* value
+);
+
+/// Insert `face => value`, or overwrite the value if `face` exists
+extern int FaceHashMap__set(
+    FaceHashMap* this,
+    const size_t* face,
+    const size_t value
+);
+
+extern bool FaceHashMap__remove(
+    FaceHashMap* this,
+    const size_t* face
+);
+
+extern size_t FaceHashMap__hash(
+    const size_t nIndices,
+    const size_t* face
+);
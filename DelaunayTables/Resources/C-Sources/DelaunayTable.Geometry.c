@@ -1,4 +1,3 @@
-
 #include "DelaunayTable.Geometry.h"
 
 
@@ -20,77 +19,44 @@ static void LAPACK__dgetrf(
     );
 }
 
-static void LAPACK__dgetri(
-          LAPACK_INTEGER           n,
-          LAPACK_DOUBLE_PRECISION* a,     /// a[lda, n]
-          LAPACK_INTEGER           lda,
-    const LAPACK_INTEGER*          ipiv,  /// ipiv[n]
-          LAPACK_DOUBLE_PRECISION* work,  /// work[max(1, lwork)]
-          LAPACK_INTEGER           lwork,
-          LAPACK_INTEGER*          info
-) {
-    dgetri_(
-        &n,
-        a,
-        &lda,
-        (LAPACK_INTEGER*) ipiv,
-        work,
-        &lwork,
-        info
-    );
-}
-
-static void LAPACK__dgemv(
+static void LAPACK__dgetrs(
           LAPACK_CHARACTER         trans,  /// one of 'N', 'T', 'C'
-          LAPACK_INTEGER           m,
           LAPACK_INTEGER           n,
-          LAPACK_DOUBLE_PRECISION  alpha,
-    const LAPACK_DOUBLE_PRECISION* a,      /// a[lda, n]
+          LAPACK_INTEGER           nrhs,
+    const LAPACK_DOUBLE_PRECISION* a,      /// a[lda, n], factorized by dgetrf
           LAPACK_INTEGER           lda,
-    const LAPACK_DOUBLE_PRECISION* x,      /// x[...]
-          LAPACK_INTEGER           incx,
-          LAPACK_DOUBLE_PRECISION  beta,
-          LAPACK_DOUBLE_PRECISION* y,
-          LAPACK_INTEGER           incy
+    const LAPACK_INTEGER*          ipiv,   /// ipiv[n]
+          LAPACK_DOUBLE_PRECISION* b,      /// b[ldb, nrhs]
+          LAPACK_INTEGER           ldb,
+          LAPACK_INTEGER*          info
 ) {
-    dgemv_(
+    dgetrs_(
         &trans,
-        &m,
         &n,
-        &alpha,
+        &nrhs,
         (LAPACK_DOUBLE_PRECISION*) a,
         &lda,
-        (LAPACK_DOUBLE_PRECISION*) x,
-        &incx,
-        &beta,
-        y,
-        &incy
+        (LAPACK_INTEGER*) ipiv,
+        b,
+        &ldb,
+        info
     );
 }
 
-static int calculate_divisionRatioMatrix(
+/**
+ * LU factorization of the edge matrix of `polygon`.
+ * In column major order (LAPACK), columns of `matrix` are edges from `polygon[0]`,
+ * - solve `matrix x = p` ('N') for the division ratio of relative point `p`,
+ * - solve `matrix^T x = b` ('T') for the circumsphere.
+ */
+static int factorize_edgeMatrix(
     const size_t nDim,
     const double* const* const polygon,  // double[nDim+1][nDim]
-          double*        const matrix    // double[nDim, nDim]
+          double*        const matrix,   // double[nDim, nDim]
+          int*           const ipiv      // int[nDim]
 ) {
-    /*
-     * # Matrix size constants
-     * Since the dimensions of the output matrix are limited to [nDim, nDim],
-     * n, m, lda and lwork all have the same value.
-     */
-
     int status = SUCCESS;
 
-    int*    ipiv = NULL;  // pivot indices (result discarded)
-    double* work = NULL;  // work address for dgetri (result discarded)
-
-    if (!(ipiv = (int*) MALLOC(nDim * sizeof(int)))) {
-        status = FAILURE; goto finally;
-    }
-    if (!(work = (double*) MALLOC(nDim * sizeof(double)))) {
-        status = FAILURE; goto finally;
-    }
-
     for (size_t jRow = 0 ; jRow < nDim ; jRow++)
     for (size_t iCol = 0 ; iCol < nDim ; iCol++) {
         matrix[nDim*jRow+iCol] = polygon[jRow+1][iCol] - polygon[0][iCol];
@@ -104,23 +70,30 @@ static int calculate_divisionRatioMatrix(
         ipiv,     // ipiv
         &status   // info
     );
-    if (status) goto finally;
 
-    LAPACK__dgetri(
+    return status;
+}
+
+static int solve_edgeMatrix(
+    const char trans,
+    const size_t nDim,
+    const double* const matrix,  // double[nDim, nDim], factorized by `factorize_edgeMatrix`
+    const int*    const ipiv,    // int[nDim]
+          double* const x        // double[nDim], right hand side on entry
+) {
+    int status = SUCCESS;
+
+    LAPACK__dgetrs(
+        trans,    // trans
         nDim,     // n
+        1,        // nrhs
         matrix,   // a
         nDim,     // lda
         ipiv,     // ipiv
-        work,     // work
-        nDim,     // lwork
+        x,        // b
+        nDim,     // ldb
         &status   // info
     );
-    if (status) goto finally;
-
-finally:
-
-    if (ipiv) FREE(ipiv);
-    if (work) FREE(work);
 
     return status;
 }
@@ -134,68 +107,191 @@ int divisionRatioFromPolygonVertices(
     int status = SUCCESS;
 
     double* matrix = NULL;  // double[nDim, nDim]
-    double* rel_p  = NULL;  // double[nDim]
+    int*    ipiv   = NULL;  // int[nDim]
 
     if (!(matrix = (double*) MALLOC(nDim * nDim * sizeof(double)))) {
         status = FAILURE; goto finally;
     }
-    if (!(rel_p = (double*) MALLOC(nDim * sizeof(double)))) {
+    if (!(ipiv   = (int*)    MALLOC(nDim * sizeof(int)))) {
         status = FAILURE; goto finally;
     }
 
-    status = calculate_divisionRatioMatrix(nDim, polygon, matrix);
-    if (status) {goto finally;}
+    status = divisionRatioFromPolygonVertices__workspace(
+        nDim, polygon, point, ratio, matrix, ipiv
+    );
+
+finally:
+
+    if (matrix) FREE(matrix);
+    if (ipiv)   FREE(ipiv);
+
+    return status;
+}
+
+int divisionRatioFromPolygonVertices__workspace(
+    const size_t nDim,
+    const double* const* const polygon,  // double[nDim+1][nDim]
+    const double*        const point,    // double[nDim]
+          double*        const ratio,    // double[nDim+1]
+          double*        const matrix,   // double[nDim, nDim]
+          int*           const ipiv      // int[nDim]
+) {
+    int status = SUCCESS;
+
+    status = factorize_edgeMatrix(nDim, polygon, matrix, ipiv);
+    if (status) {return status;}
 
     for (size_t i = 0 ; i < nDim ; i++) {
-        rel_p[i] = point[i] - polygon[0][i];
-    }
-
-    LAPACK__dgemv(
-        'N',        // trans
-        nDim,       // m
-        nDim,       // n
-        1.0,        // alpha
-        matrix,     // a
-        nDim,       // lda
-        rel_p,      // x
-        1,          // incx
-        0.0,        // beta
-        &ratio[1],  // y
-        1           // incy
-    );
+        ratio[i+1] = point[i] - polygon[0][i];
+    }
+
+    status = solve_edgeMatrix('N', nDim, matrix, ipiv, &ratio[1]);
+    if (status) {return status;}
 
     ratio[0] = 1.0;
     for(size_t i = 1 ; i < (nDim+1) ; i++) {
         ratio[0] -= ratio[i];
     }
 
+    return status;
+}
+
+int jacobianOnPolygon__workspace(
+    const size_t nDim,
+    const size_t nOut,
+    const double* const* const polygon,   // double[nDim+1][nDim]
+    const double* const* const values,    // double[nDim+1][nOut]
+          double*        const jacobian,  // double[nOut][nDim]
+          double*        const matrix,    // double[nDim, nDim]
+          int*           const ipiv       // int[nDim]
+) {
+    int status = SUCCESS;
+
+    status = factorize_edgeMatrix(nDim, polygon, matrix, ipiv);
+    if (status) {return status;}
+
+    // Row iOut of the jacobian solves `matrix^T x = g`, g[i] is the difference of values along edge i
+    for (size_t iOut = 0 ; iOut < nOut ; iOut++) {
+        double* const row = &jacobian[nDim*iOut];
+        for (size_t i = 0 ; i < nDim ; i++) {
+            row[i] = values[i+1][iOut] - values[0][iOut];
+        }
+
+        status = solve_edgeMatrix('T', nDim, matrix, ipiv, row);
+        if (status) {return status;}
+    }
+
+    return status;
+}
+
+int barycentricTransformOfPolygon(
+    const size_t nDim,
+    const double* const* const polygon,   // double[nDim+1][nDim]
+          double*        const transform  // double[nDim][nDim]
+) {
+    int status = SUCCESS;
+
+    double* matrix = NULL;  // double[nDim, nDim]
+    int*    ipiv   = NULL;  // int[nDim]
+    double* column = NULL;  // double[nDim]
+
+    if (!(matrix = (double*) MALLOC(nDim * nDim * sizeof(double)))) {
+        status = FAILURE; goto finally;
+    }
+    if (!(ipiv   = (int*)    MALLOC(nDim * sizeof(int)))) {
+        status = FAILURE; goto finally;
+    }
+    if (!(column = (double*) MALLOC(nDim * sizeof(double)))) {
+        status = FAILURE; goto finally;
+    }
+
+    status = factorize_edgeMatrix(nDim, polygon, matrix, ipiv);
+    if (status) {goto finally;}
+
+    // Column j of the inverse is the solution for the unit vector e_j
+    for (size_t j = 0 ; j < nDim ; j++) {
+        for (size_t i = 0 ; i < nDim ; i++) {
+            column[i] = (i == j) ? 1.0 : 0.0;
+        }
+
+        status = solve_edgeMatrix('N', nDim, matrix, ipiv, column);
+        if (status) {goto finally;}
+
+        for (size_t i = 0 ; i < nDim ; i++) {
+            transform[nDim*i+j] = column[i];
+        }
+    }
+
 finally:
 
-    if (matrix) FREE(matrix);
-    if (rel_p)  FREE(rel_p);
+    if (matrix) {FREE(matrix);}
+    if (ipiv)   {FREE(ipiv);}
+    if (column) {FREE(column);}
 
     return status;
 }
 
-int insideCircumsphereOfPolygon(
+int circumcenterOfPolygon(
     const size_t nDim,
     const double* const* const polygon,  // double[nDim+1][nDim]
-    const double*        const point,    // double[nDim]
-    bool* const inside
+          double*        const center,   // double[nDim]
+          double*        const determinant
 ) {
     int status = SUCCESS;
 
-    double* matrix    = NULL;  // double matrix[nDim, nDim]
-    double* normsPer2 = NULL;  // double normsPer2[nDim]
-    double* centor    = NULL;  // double centor[nDim]
+    double* matrix = NULL;  // double matrix[nDim, nDim]
+    int*    ipiv   = NULL;  // int ipiv[nDim]
 
-    if (!(matrix    = (double*) MALLOC(nDim * nDim * sizeof(double)))) {
+    if (!(matrix = (double*) MALLOC(nDim * nDim * sizeof(double)))) {
         status = FAILURE; goto finally;
     }
-    if (!(normsPer2 = (double*) MALLOC(nDim * sizeof(double)))) {
+    if (!(ipiv   = (int*)    MALLOC(nDim * sizeof(int)))) {
         status = FAILURE; goto finally;
     }
-    if (!(centor    = (double*) MALLOC(nDim * sizeof(double)))) {
+
+    status = factorize_edgeMatrix(nDim, polygon, matrix, ipiv);
+    if (status) {goto finally;}
+
+    // (P_i - P0) . c = |P_i - P0|^2 / 2
+    for (size_t i = 0 ; i < nDim ; i++) {
+        double norm = 0.0;
+        for (size_t j = 0 ; j < nDim ; j++) {
+            norm += (
+               (polygon[i+1][j] - polygon[0][j]) *
+               (polygon[i+1][j] - polygon[0][j])
+            );
+        }
+        center[i] = norm / 2.0;
+    }
+
+    status = solve_edgeMatrix('T', nDim, matrix, ipiv, center);
+    if (status) {goto finally;}
+
+    // Diagonal of U
+    *determinant = 1.0;
+    for (size_t i = 0 ; i < nDim ; i++) {
+        *determinant *= fabs(matrix[nDim*i+i]);
+    }
+
+finally:
+
+    if (matrix) {FREE(matrix);}
+    if (ipiv)   {FREE(ipiv);}
+
+    return status;
+}
+
+int insideCircumsphereOfPolygon(
+    const size_t nDim,
+    const double* const* const polygon,  // double[nDim+1][nDim]
+    const double*        const point,    // double[nDim]
+    bool* const inside
+) {
+    int status = SUCCESS;
+
+    double* centor = NULL;  // double centor[nDim]
+
+    if (!(centor = (double*) MALLOC(nDim * sizeof(double)))) {
         status = FAILURE; goto finally;
     }
 
@@ -216,34 +312,10 @@ int insideCircumsphereOfPolygon(
      *                             (Pn)
      */
 
-    status = calculate_divisionRatioMatrix(nDim, polygon, matrix);
+    double determinant;
+    status = circumcenterOfPolygon(nDim, polygon, centor, &determinant);
     if (status) {goto finally;}
 
-    for (size_t i = 0 ; i < nDim ; i++) {
-        double norm = 0.0;
-        for (size_t j = 0 ; j < nDim ; j++) {
-            norm += (
-               (polygon[i+1][j] - polygon[0][j]) *
-               (polygon[i+1][j] - polygon[0][j])
-            );
-        }
-        normsPer2[i] = norm / 2.0;
-    }
-
-    LAPACK__dgemv(
-        'T',        // trans
-        nDim,       // m
-        nDim,       // n
-        1.0,        // alpha
-        matrix,     // x
-        nDim,       // lda
-        normsPer2,  // x
-        1,          // incx
-        0.0,        // beta
-        centor,     // y
-        1           // incy
-    );
-
     /*
      * c := (C - P0) :: Relative vector from P0 to C
      * p := (Q - P0) :: Relative vector from P0 to Q
@@ -273,9 +345,627 @@ int insideCircumsphereOfPolygon(
 
 finally:
 
-    if (matrix)    {FREE(matrix);}
-    if (normsPer2) {FREE(normsPer2);}
-    if (centor)    {FREE(centor);}
+    if (centor) {FREE(centor);}
 
     return status;
 }
+
+
+/// # Fixed dimension kernels
+/// Largest `nDim` of specialized kernels
+#define Geometry__maxFixedDim (6)
+
+/**
+ * Solve `a x = b` by LU decomposition with partial pivoting,
+ * `a` (double[n][n], row major) and `b` (double[n]) are overwritten, `b` becomes `x`,
+ * `determinant` is the product of pivots.
+ * Fails on an exactly zero pivot, same as `dgetrf`.
+ * Inlined into kernels of fixed `n`, so loops have constant bounds.
+ */
+static inline int solve__fixed(
+    const size_t n,
+    double* const a,
+    double* const b,
+    double* const determinant  // |det a|
+) {
+    for (size_t k = 0 ; k < n ; k++) {
+        size_t pivot = k;
+        for (size_t i = k+1 ; i < n ; i++) {
+            if (fabs(a[n*i+k]) > fabs(a[n*pivot+k])) {pivot = i;}
+        }
+        if (a[n*pivot+k] == 0.0) {return FAILURE;}
+
+        if (pivot != k) {
+            for (size_t j = k ; j < n ; j++) {
+                const double swap = a[n*k+j]; a[n*k+j] = a[n*pivot+j]; a[n*pivot+j] = swap;
+            }
+            const double swap = b[k]; b[k] = b[pivot]; b[pivot] = swap;
+        }
+
+        for (size_t i = k+1 ; i < n ; i++) {
+            const double factor = a[n*i+k] / a[n*k+k];
+            for (size_t j = k+1 ; j < n ; j++) {
+                a[n*i+j] -= factor * a[n*k+j];
+            }
+            b[i] -= factor * b[k];
+        }
+    }
+
+    *determinant = 1.0;
+    for (size_t k = n ; k-- > 0 ; ) {
+        for (size_t j = k+1 ; j < n ; j++) {
+            b[k] -= a[n*k+j] * b[j];
+        }
+        b[k] /= a[n*k+k];
+        *determinant *= fabs(a[n*k+k]);
+    }
+
+    return SUCCESS;
+}
+
+static inline int divisionRatio__fixed(
+    const size_t n,
+    const double* const* const polygon,  // double[n+1][n]
+    const double*        const point,    // double[n]
+          double*        const ratio     // double[n+1]
+) {
+    double a[Geometry__maxFixedDim * Geometry__maxFixedDim];
+
+    // Columns of `a` are edges from `polygon[0]`
+    for (size_t i = 0 ; i < n ; i++) {
+        for (size_t j = 0 ; j < n ; j++) {
+            a[n*i+j] = polygon[j+1][i] - polygon[0][i];
+        }
+        ratio[i+1] = point[i] - polygon[0][i];
+    }
+
+    double determinant;
+    if (solve__fixed(n, a, &ratio[1], &determinant)) {return FAILURE;}
+
+    ratio[0] = 1.0;
+    for (size_t i = 1 ; i < (n+1) ; i++) {
+        ratio[0] -= ratio[i];
+    }
+
+    return SUCCESS;
+}
+
+static inline int circumcenter__fixed(
+    const size_t n,
+    const double* const* const polygon,  // double[n+1][n]
+          double*        const center,   // double[n]
+          double*        const determinant
+) {
+    double a[Geometry__maxFixedDim * Geometry__maxFixedDim];
+
+    // Rows of `a` are edges from `polygon[0]`, see `insideCircumsphereOfPolygon`
+    for (size_t i = 0 ; i < n ; i++) {
+        double norm = 0.0;
+        for (size_t j = 0 ; j < n ; j++) {
+            const double edge = polygon[i+1][j] - polygon[0][j];
+            a[n*i+j] = edge;
+            norm += edge * edge;
+        }
+        center[i] = norm / 2.0;
+    }
+
+    return solve__fixed(n, a, center, determinant);
+}
+
+static inline int insideCircumsphere__fixed(
+    const size_t n,
+    const double* const* const polygon,  // double[n+1][n]
+    const double*        const point,    // double[n]
+    bool* const inside
+) {
+    double center[Geometry__maxFixedDim];
+
+    double determinant;
+    if (circumcenter__fixed(n, polygon, center, &determinant)) {return FAILURE;}
+
+    double judgement = 0.0;
+    for (size_t i = 0 ; i < n ; i++) {
+        const double q_i = point[i] - polygon[0][i];
+        judgement += q_i * (q_i - 2*center[i]);
+    }
+    *inside = double__compare(judgement, 0.0) <= 0;
+
+    return SUCCESS;
+}
+
+#define Geometry__define_fixed_kernels(N)                                                 \
+    static int divisionRatio__##N(                                                        \
+        const size_t nDim,                                                                \
+        const double* const* const polygon,                                               \
+        const double*        const point,                                                 \
+              double*        const ratio                                                  \
+    ) {                                                                                   \
+        (void) nDim;                                                                      \
+        return divisionRatio__fixed(N, polygon, point, ratio);                            \
+    }                                                                                     \
+                                                                                          \
+    static int insideCircumsphere__##N(                                                   \
+        const size_t nDim,                                                                \
+        const double* const* const polygon,                                               \
+        const double*        const point,                                                 \
+        bool* const inside                                                                \
+    ) {                                                                                   \
+        (void) nDim;                                                                      \
+        return insideCircumsphere__fixed(N, polygon, point, inside);                      \
+    }                                                                                     \
+                                                                                          \
+    static int circumcenter__##N(                                                         \
+        const size_t nDim,                                                                \
+        const double* const* const polygon,                                               \
+              double*        const center,                                                \
+              double*        const determinant                                            \
+    ) {                                                                                   \
+        (void) nDim;                                                                      \
+        return circumcenter__fixed(N, polygon, center, determinant);                      \
+    }
+
+Geometry__define_fixed_kernels(1)
+Geometry__define_fixed_kernels(2)
+Geometry__define_fixed_kernels(3)
+Geometry__define_fixed_kernels(4)
+Geometry__define_fixed_kernels(5)
+Geometry__define_fixed_kernels(6)
+
+#undef Geometry__define_fixed_kernels
+
+
+/** # SIMD kernels
+ * Kernels of `nDim` 3 to 6 compiled for AVX2 and AVX-512 by target attributes,
+ * selected at runtime by `InstructionSet__detect`.
+ * Scalar kernels of `nDim` 1 and 2 are faster than any shuffling of lanes, they are kept.
+ * Each row of the augmented matrix [A | b] is a vector of 8 lanes (`Row__<isa>`),
+ * lanes after b are zero. It is solved by Gauss-Jordan elimination with partial pivoting,
+ * so every elimination step is one fused multiply-add of whole rows,
+ * and rows stay in registers once loops of fixed `n` are unrolled.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define Geometry__x86_dispatch (1)
+#else
+#define Geometry__x86_dispatch (0)
+#endif
+
+#if Geometry__x86_dispatch
+
+#include <immintrin.h>
+
+
+/// ## AVX2, a row is a pair of 4 lanes
+typedef struct {
+    __m256d lo;
+    __m256d hi;
+} Row__avx2;
+
+__attribute__((target("avx2,fma")))
+static inline __m256d load4__avx2(
+    const size_t count,  // number of lanes to load, lanes after are zero
+    const double* const p
+) {
+    if (count >= 4) {return _mm256_loadu_pd(p);}
+    if (count == 0) {return _mm256_setzero_pd();}
+
+    const __m256i mask = _mm256_cmpgt_epi64(
+        _mm256_set1_epi64x((long long) count),
+        _mm256_setr_epi64x(0, 1, 2, 3)
+    );
+    return _mm256_maskload_pd(p, mask);
+}
+
+__attribute__((target("avx2,fma")))
+static inline Row__avx2 Row__load__avx2(
+    const size_t n,
+    const double* const p  // double[n]
+) {
+    const Row__avx2 row = {
+        load4__avx2(n, p),
+        (n > 4) ? load4__avx2(n - 4, &p[4]) : _mm256_setzero_pd()
+    };
+    return row;
+}
+
+__attribute__((target("avx2,fma")))
+static inline Row__avx2 Row__sub__avx2(
+    const Row__avx2 x,
+    const Row__avx2 y
+) {
+    const Row__avx2 row = {_mm256_sub_pd(x.lo, y.lo), _mm256_sub_pd(x.hi, y.hi)};
+    return row;
+}
+
+__attribute__((target("avx2,fma")))
+static inline double Row__dot__avx2(
+    const Row__avx2 x,
+    const Row__avx2 y
+) {
+    const __m256d sum  = _mm256_fmadd_pd(x.hi, y.hi, _mm256_mul_pd(x.lo, y.lo));
+    const __m128d pair = _mm_add_pd(_mm256_castpd256_pd128(sum), _mm256_extractf128_pd(sum, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+}
+
+__attribute__((target("avx2,fma")))
+static inline double Row__lane__avx2(
+    const Row__avx2 row,
+    const size_t k
+) {
+    const __m256d half  = (k < 4) ? row.lo : row.hi;
+    const int     index = (int) (2 * (k % 4));
+    const __m256i lanes = _mm256_setr_epi32(index, index + 1, 0, 0, 0, 0, 0, 0);
+    return _mm256_cvtsd_f64(_mm256_castsi256_pd(
+        _mm256_permutevar8x32_epi32(_mm256_castpd_si256(half), lanes)
+    ));
+}
+
+__attribute__((target("avx2,fma")))
+static inline Row__avx2 Row__set_lane__avx2(
+    const Row__avx2 row,
+    const size_t k,
+    const double value
+) {
+    const __m256i index = _mm256_set1_epi64x((long long) k);
+    const Row__avx2 result = {
+        _mm256_blendv_pd(row.lo, _mm256_set1_pd(value), _mm256_castsi256_pd(
+            _mm256_cmpeq_epi64(index, _mm256_setr_epi64x(0, 1, 2, 3))
+        )),
+        _mm256_blendv_pd(row.hi, _mm256_set1_pd(value), _mm256_castsi256_pd(
+            _mm256_cmpeq_epi64(index, _mm256_setr_epi64x(4, 5, 6, 7))
+        ))
+    };
+    return result;
+}
+
+/// `row - factor * pivotRow` on lanes [0, n]
+__attribute__((target("avx2,fma")))
+static inline Row__avx2 Row__eliminate__avx2(
+    const size_t n,
+    const Row__avx2 row,
+    const double factor,
+    const Row__avx2 pivotRow
+) {
+    const __m256d f = _mm256_set1_pd(factor);
+    const Row__avx2 result = {
+        _mm256_fnmadd_pd(f, pivotRow.lo, row.lo),
+        ((n+1) > 4) ? _mm256_fnmadd_pd(f, pivotRow.hi, row.hi) : row.hi
+    };
+    return result;
+}
+
+/// Row `i` of A (columns are `polygon[j+1] - polygon[0]`) and b (`point - polygon[0]`)
+__attribute__((target("avx2,fma")))
+static inline Row__avx2 Row__column__avx2(
+    const size_t n,
+    const double* const* const polygon,
+    const double*        const point,
+    const size_t i
+) {
+    double lanes[8];
+    for (size_t j = 0 ; j < 8 ; j++) {
+        lanes[j] = (j < n) ? polygon[j+1][i] : ((j == n) ? point[i] : polygon[0][i]);
+    }
+
+    const __m256d origin = _mm256_set1_pd(polygon[0][i]);
+    const Row__avx2 row = {
+        _mm256_sub_pd(_mm256_setr_pd(lanes[0], lanes[1], lanes[2], lanes[3]), origin),
+        _mm256_sub_pd(_mm256_setr_pd(lanes[4], lanes[5], lanes[6], lanes[7]), origin)
+    };
+    return row;
+}
+
+
+/// ## AVX-512, a row is 8 lanes
+typedef __m512d Row__avx512;
+
+__attribute__((target("avx512f")))
+static inline Row__avx512 Row__load__avx512(
+    const size_t n,
+    const double* const p
+) {
+    return _mm512_maskz_loadu_pd((__mmask8) ((1u << n) - 1), p);
+}
+
+__attribute__((target("avx512f")))
+static inline Row__avx512 Row__sub__avx512(
+    const Row__avx512 x,
+    const Row__avx512 y
+) {
+    return _mm512_sub_pd(x, y);
+}
+
+__attribute__((target("avx512f")))
+static inline double Row__dot__avx512(
+    const Row__avx512 x,
+    const Row__avx512 y
+) {
+    return _mm512_reduce_add_pd(_mm512_mul_pd(x, y));
+}
+
+__attribute__((target("avx512f")))
+static inline double Row__lane__avx512(
+    const Row__avx512 row,
+    const size_t k
+) {
+    return _mm_cvtsd_f64(_mm512_castpd512_pd128(
+        _mm512_permutexvar_pd(_mm512_set1_epi64((long long) k), row)
+    ));
+}
+
+__attribute__((target("avx512f")))
+static inline Row__avx512 Row__set_lane__avx512(
+    const Row__avx512 row,
+    const size_t k,
+    const double value
+) {
+    return _mm512_mask_mov_pd(row, (__mmask8) (1u << k), _mm512_set1_pd(value));
+}
+
+__attribute__((target("avx512f")))
+static inline Row__avx512 Row__eliminate__avx512(
+    const size_t n,
+    const Row__avx512 row,
+    const double factor,
+    const Row__avx512 pivotRow
+) {
+    (void) n;
+    return _mm512_fnmadd_pd(_mm512_set1_pd(factor), pivotRow, row);
+}
+
+__attribute__((target("avx512f")))
+static inline Row__avx512 Row__column__avx512(
+    const size_t n,
+    const double* const* const polygon,
+    const double*        const point,
+    const size_t i
+) {
+    double lanes[8];
+    for (size_t j = 0 ; j < 8 ; j++) {
+        lanes[j] = (j < n) ? polygon[j+1][i] : ((j == n) ? point[i] : polygon[0][i]);
+    }
+
+    return _mm512_sub_pd(
+        _mm512_setr_pd(lanes[0], lanes[1], lanes[2], lanes[3], lanes[4], lanes[5], lanes[6], lanes[7]),
+        _mm512_set1_pd(polygon[0][i])
+    );
+}
+
+
+/// ## Kernels
+/**
+ * Same as `divisionRatio__fixed` and `insideCircumsphere__fixed` on `Row__<isa>`.
+ * `solve__<isa>` solves [A | b] (b in lane n of `rows`) into `x` by Gauss-Jordan elimination.
+ */
+#define Geometry__define_simd_kernels(ISA, TARGET)                                        \
+    __attribute__((target(TARGET)))                                                       \
+    static inline int solve__##ISA(                                                       \
+        const size_t n,                                                                   \
+        Row__##ISA* const rows,                                                           \
+        double* const x,                                                                  \
+        double* const determinant                                                         \
+    ) {                                                                                   \
+        *determinant = 1.0;                                                               \
+        for (size_t k = 0 ; k < n ; k++) {                                                \
+            size_t pivot = k;                                                             \
+            double pivotValue = fabs(Row__lane__##ISA(rows[k], k));                       \
+            for (size_t i = k+1 ; i < n ; i++) {                                          \
+                const double value = fabs(Row__lane__##ISA(rows[i], k));                  \
+                if (value > pivotValue) {pivot = i; pivotValue = value;}                  \
+            }                                                                             \
+            if (pivotValue == 0.0) {return FAILURE;}                                      \
+            *determinant *= pivotValue;                                                   \
+                                                                                          \
+            for (size_t i = k+1 ; i < n ; i++) {                                          \
+                if (i == pivot) {                                                         \
+                    const Row__##ISA swap = rows[k]; rows[k] = rows[i]; rows[i] = swap;   \
+                }                                                                         \
+            }                                                                             \
+                                                                                          \
+            const double inverse = 1.0 / Row__lane__##ISA(rows[k], k);                    \
+            for (size_t i = 0 ; i < n ; i++) {                                            \
+                if (i == k) {continue;}                                                   \
+                const double factor = Row__lane__##ISA(rows[i], k) * inverse;             \
+                rows[i] = Row__eliminate__##ISA(n, rows[i], factor, rows[k]);             \
+            }                                                                             \
+        }                                                                                 \
+                                                                                          \
+        for (size_t k = 0 ; k < n ; k++) {                                                \
+            x[k] = Row__lane__##ISA(rows[k], n) / Row__lane__##ISA(rows[k], k);           \
+        }                                                                                 \
+                                                                                          \
+        return SUCCESS;                                                                   \
+    }                                                                                     \
+                                                                                          \
+    __attribute__((target(TARGET)))                                                       \
+    static inline int divisionRatio__##ISA(                                               \
+        const size_t n,                                                                   \
+        const double* const* const polygon,                                               \
+        const double*        const point,                                                 \
+              double*        const ratio                                                  \
+    ) {                                                                                   \
+        Row__##ISA rows[Geometry__maxFixedDim];                                           \
+        for (size_t i = 0 ; i < n ; i++) {                                                \
+            rows[i] = Row__column__##ISA(n, polygon, point, i);                           \
+        }                                                                                 \
+                                                                                          \
+        double determinant;                                                               \
+        if (solve__##ISA(n, rows, &ratio[1], &determinant)) {return FAILURE;}             \
+                                                                                          \
+        ratio[0] = 1.0;                                                                   \
+        for (size_t i = 1 ; i < (n+1) ; i++) {                                            \
+            ratio[0] -= ratio[i];                                                         \
+        }                                                                                 \
+                                                                                          \
+        return SUCCESS;                                                                   \
+    }                                                                                     \
+                                                                                          \
+    __attribute__((target(TARGET)))                                                       \
+    static inline int circumcenter__##ISA(                                                \
+        const size_t n,                                                                   \
+        const double* const* const polygon,                                               \
+              double*        const center,                                                \
+              double*        const determinant                                            \
+    ) {                                                                                   \
+        Row__##ISA rows[Geometry__maxFixedDim];                                           \
+                                                                                          \
+        /* Rows of A are edges from `polygon[0]`, b is their squared norms / 2 */         \
+        const Row__##ISA origin = Row__load__##ISA(n, polygon[0]);                        \
+        for (size_t i = 0 ; i < n ; i++) {                                                \
+            const Row__##ISA edge = Row__sub__##ISA(Row__load__##ISA(n, polygon[i+1]), origin); \
+            rows[i] = Row__set_lane__##ISA(edge, n, Row__dot__##ISA(edge, edge) / 2.0);   \
+        }                                                                                 \
+                                                                                          \
+        return solve__##ISA(n, rows, center, determinant);                                \
+    }                                                                                     \
+                                                                                          \
+    __attribute__((target(TARGET)))                                                       \
+    static inline int insideCircumsphere__##ISA(                                          \
+        const size_t n,                                                                   \
+        const double* const* const polygon,                                               \
+        const double*        const point,                                                 \
+        bool* const inside                                                                \
+    ) {                                                                                   \
+        double center[Geometry__maxFixedDim];                                             \
+                                                                                          \
+        double determinant;                                                               \
+        if (circumcenter__##ISA(n, polygon, center, &determinant)) {return FAILURE;}      \
+                                                                                          \
+        double judgement = 0.0;                                                           \
+        for (size_t i = 0 ; i < n ; i++) {                                                \
+            const double q_i = point[i] - polygon[0][i];                                  \
+            judgement += q_i * (q_i - 2*center[i]);                                       \
+        }                                                                                 \
+        *inside = double__compare(judgement, 0.0) <= 0;                                   \
+                                                                                          \
+        return SUCCESS;                                                                   \
+    }
+
+Geometry__define_simd_kernels(avx2,   "avx2,fma")
+Geometry__define_simd_kernels(avx512, "avx512f")
+
+#undef Geometry__define_simd_kernels
+
+#define Geometry__define_fixed_simd_kernels(ISA, TARGET, N)                               \
+    __attribute__((target(TARGET)))                                                       \
+    static int divisionRatio__##ISA##__##N(                                               \
+        const size_t nDim,                                                                \
+        const double* const* const polygon,                                               \
+        const double*        const point,                                                 \
+              double*        const ratio                                                  \
+    ) {                                                                                   \
+        (void) nDim;                                                                      \
+        return divisionRatio__##ISA(N, polygon, point, ratio);                            \
+    }                                                                                     \
+                                                                                          \
+    __attribute__((target(TARGET)))                                                       \
+    static int insideCircumsphere__##ISA##__##N(                                          \
+        const size_t nDim,                                                                \
+        const double* const* const polygon,                                               \
+        const double*        const point,                                                 \
+        bool* const inside                                                                \
+    ) {                                                                                   \
+        (void) nDim;                                                                      \
+        return insideCircumsphere__##ISA(N, polygon, point, inside);                      \
+    }                                                                                     \
+                                                                                          \
+    __attribute__((target(TARGET)))                                                       \
+    static int circumcenter__##ISA##__##N(                                                \
+        const size_t nDim,                                                                \
+        const double* const* const polygon,                                               \
+              double*        const center,                                                \
+              double*        const determinant                                            \
+    ) {                                                                                   \
+        (void) nDim;                                                                      \
+        return circumcenter__##ISA(N, polygon, center, determinant);                      \
+    }
+
+Geometry__define_fixed_simd_kernels(avx2,   "avx2,fma", 3)
+Geometry__define_fixed_simd_kernels(avx2,   "avx2,fma", 4)
+Geometry__define_fixed_simd_kernels(avx2,   "avx2,fma", 5)
+Geometry__define_fixed_simd_kernels(avx2,   "avx2,fma", 6)
+Geometry__define_fixed_simd_kernels(avx512, "avx512f",  3)
+Geometry__define_fixed_simd_kernels(avx512, "avx512f",  4)
+Geometry__define_fixed_simd_kernels(avx512, "avx512f",  5)
+Geometry__define_fixed_simd_kernels(avx512, "avx512f",  6)
+
+#undef Geometry__define_fixed_simd_kernels
+
+#endif  // Geometry__x86_dispatch
+
+
+enum InstructionSet InstructionSet__detect(
+) {
+#if Geometry__x86_dispatch
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f")) {
+        return InstructionSet__avx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return InstructionSet__avx2;
+    }
+#endif
+
+    return InstructionSet__scalar;
+}
+
+GeometryKernels GeometryKernels__select_instructionSet(
+    const size_t nDim,
+    enum InstructionSet instructionSet
+) {
+    static const GeometryKernels fixedKernels[Geometry__maxFixedDim] = {
+        {divisionRatio__1, insideCircumsphere__1, circumcenter__1},
+        {divisionRatio__2, insideCircumsphere__2, circumcenter__2},
+        {divisionRatio__3, insideCircumsphere__3, circumcenter__3},
+        {divisionRatio__4, insideCircumsphere__4, circumcenter__4},
+        {divisionRatio__5, insideCircumsphere__5, circumcenter__5},
+        {divisionRatio__6, insideCircumsphere__6, circumcenter__6}
+    };
+
+    const enum InstructionSet supported = InstructionSet__detect();
+    if (instructionSet > supported) {
+        instructionSet = supported;
+    }
+
+#if Geometry__x86_dispatch
+    // nDim = 1, 2 are scalar
+    static const GeometryKernels avx2Kernels[Geometry__maxFixedDim] = {
+        {divisionRatio__1,         insideCircumsphere__1,         circumcenter__1        },
+        {divisionRatio__2,         insideCircumsphere__2,         circumcenter__2        },
+        {divisionRatio__avx2__3,   insideCircumsphere__avx2__3,   circumcenter__avx2__3  },
+        {divisionRatio__avx2__4,   insideCircumsphere__avx2__4,   circumcenter__avx2__4  },
+        {divisionRatio__avx2__5,   insideCircumsphere__avx2__5,   circumcenter__avx2__5  },
+        {divisionRatio__avx2__6,   insideCircumsphere__avx2__6,   circumcenter__avx2__6  }
+    };
+    static const GeometryKernels avx512Kernels[Geometry__maxFixedDim] = {
+        {divisionRatio__1,         insideCircumsphere__1,         circumcenter__1        },
+        {divisionRatio__2,         insideCircumsphere__2,         circumcenter__2        },
+        {divisionRatio__avx512__3, insideCircumsphere__avx512__3, circumcenter__avx512__3},
+        {divisionRatio__avx512__4, insideCircumsphere__avx512__4, circumcenter__avx512__4},
+        {divisionRatio__avx512__5, insideCircumsphere__avx512__5, circumcenter__avx512__5},
+        {divisionRatio__avx512__6, insideCircumsphere__avx512__6, circumcenter__avx512__6}
+    };
+
+    if (1 <= nDim && nDim <= Geometry__maxFixedDim) {
+        if (instructionSet == InstructionSet__avx512) {return avx512Kernels[nDim-1];}
+        if (instructionSet == InstructionSet__avx2)   {return avx2Kernels  [nDim-1];}
+    }
+#endif
+
+    if (1 <= nDim && nDim <= Geometry__maxFixedDim) {
+        return fixedKernels[nDim-1];
+    }
+
+    const GeometryKernels genericKernels = {
+        divisionRatioFromPolygonVertices,
+        insideCircumsphereOfPolygon,
+        circumcenterOfPolygon
+    };
+    return genericKernels;
+}
+
+GeometryKernels GeometryKernels__select(
+    const size_t nDim
+) {
+    return GeometryKernels__select_instructionSet(nDim, InstructionSet__detect());
+}
@@ -62,6 +62,50 @@ extern int divisionRatioFromPolygonVertices(
           double*        ratio     // double[nDim+1]
 );
 
+/// `divisionRatioFromPolygonVertices` in work areas of the caller (no allocation)
+extern int divisionRatioFromPolygonVertices__workspace(
+    const size_t nDim,
+    const double* const* polygon,  // double[nDim+1][nDim]
+    const double*        point,    // double[nDim]
+          double*        ratio,    // double[nDim+1]
+          double*        matrix,   // double[nDim][nDim]
+          int*           ipiv      // int[nDim]
+);
+
+/**
+ * Jacobian of the affine function on `polygon` which takes `values[i]` at `polygon[i]`,
+ * `jacobian[iOut][j]` is the derivative of output `iOut` with respect to coordinate `j`.
+ * In work areas of the caller (no allocation).
+ */
+extern int jacobianOnPolygon__workspace(
+    const size_t nDim,
+    const size_t nOut,
+    const double* const* polygon,   // double[nDim+1][nDim]
+    const double* const* values,    // double[nDim+1][nOut]
+          double*        jacobian,  // double[nOut][nDim]
+          double*        matrix,    // double[nDim][nDim]
+          int*           ipiv       // int[nDim]
+);
+
+/// `jacobianOnPolygon__workspace` by the barycentric transform of `polygon`
+static inline void jacobian__from_transform(
+    const size_t nDim,
+    const size_t nOut,
+    const double* const  transform,  // double[nDim][nDim]
+    const double* const* values,     // double[nDim+1][nOut]
+          double* const  jacobian    // double[nOut][nDim]
+) {
+    for (size_t iOut = 0 ; iOut < nOut ; iOut++) {
+        for (size_t j = 0 ; j < nDim ; j++) {
+            double sum = 0.0;
+            for (size_t i = 0 ; i < nDim ; i++) {
+                sum += (values[i+1][iOut] - values[0][iOut]) * transform[nDim*i+j];
+            }
+            jacobian[nDim*iOut+j] = sum;
+        }
+    }
+}
+
 extern int insideCircumsphereOfPolygon(
     const size_t nDim,
     const double* const* polygon,  // double[nDim+1][nDim]
@@ -69,6 +113,104 @@ extern int insideCircumsphereOfPolygon(
     bool* inside
 );
 
+/**
+ * Center of the circumsphere of `polygon` relative to `polygon[0]`.
+ * `determinant` is `|det E|` of the edge matrix E (rows are edges from `polygon[0]`).
+ */
+extern int circumcenterOfPolygon(
+    const size_t nDim,
+    const double* const* polygon,  // double[nDim+1][nDim]
+          double*        center,   // double[nDim]
+          double*        determinant
+);
+
+/**
+ * Barycentric transform of `polygon`, the inverse of its edge matrix
+ * (columns are edges from `polygon[0]`), see `divisionRatio__from_transform`.
+ */
+extern int barycentricTransformOfPolygon(
+    const size_t nDim,
+    const double* const* polygon,  // double[nDim+1][nDim]
+          double*        transform // double[nDim][nDim]
+);
+
+/// Division ratio of `point` by the barycentric transform of a polygon whose first vertex is `origin`
+static inline void divisionRatio__from_transform(
+    const size_t nDim,
+    const double* const transform,  // double[nDim][nDim]
+    const double* const origin,     // double[nDim]
+    const double* const point,      // double[nDim]
+          double* const ratio       // double[nDim+1]
+) {
+    ratio[0] = 1.0;
+    for (size_t i = 0 ; i < nDim ; i++) {
+        double sum = 0.0;
+        for (size_t j = 0 ; j < nDim ; j++) {
+            sum += transform[nDim*i+j] * (point[j] - origin[j]);
+        }
+        ratio[i+1]  = sum;
+        ratio[0]   -= sum;
+    }
+}
+
+/** # Geometry kernels
+ * Geometry functions of a fixed dimension, selected once per table.
+ * Kernels for `nDim` of 1 to 6 are specialized with fixed size arrays on the stack,
+ * and those of 3 to 6 are vectorized by AVX2 or AVX-512 if the CPU supports them,
+ * the generic functions above (LAPACK) are used for the other dimensions.
+ */
+typedef int Geometry__divisionRatio(
+    const size_t nDim,
+    const double* const* polygon,  // double[nDim+1][nDim]
+    const double*        point,    // double[nDim]
+          double*        ratio     // double[nDim+1]
+);
+
+typedef int Geometry__insideCircumsphere(
+    const size_t nDim,
+    const double* const* polygon,  // double[nDim+1][nDim]
+    const double*        point,    // double[nDim]
+    bool* inside
+);
+
+typedef int Geometry__circumcenter(
+    const size_t nDim,
+    const double* const* polygon,  // double[nDim+1][nDim]
+          double*        center,   // double[nDim]
+          double*        determinant
+);
+
+typedef struct {
+    Geometry__divisionRatio*      divisionRatio;
+    Geometry__insideCircumsphere* insideCircumsphere;
+    Geometry__circumcenter*       circumcenter;
+} GeometryKernels;
+
+/// SIMD extensions of x86 CPUs used by geometry kernels
+enum InstructionSet {
+    InstructionSet__scalar = 1,
+    InstructionSet__avx2,       /// AVX2 and FMA
+    InstructionSet__avx512      /// AVX-512F
+};
+
+/**
+ * Best instruction set of the running CPU.
+ * Always `InstructionSet__scalar` on other CPUs or compilers without GCC builtins.
+ */
+extern enum InstructionSet InstructionSet__detect(
+);
+
+/// Kernels for `nDim` on the best instruction set of the running CPU
+extern GeometryKernels GeometryKernels__select(
+    const size_t nDim
+);
+
+/// Kernels for `nDim` on `instructionSet`, lowered to one the CPU supports
+extern GeometryKernels GeometryKernels__select_instructionSet(
+    const size_t nDim,
+    enum InstructionSet instructionSet
+);
+
 static inline bool divisionRatio__inside(
     const size_t nDim,
     const double* const divisionRatio
@@ -109,26 +251,14 @@ extern void dgetrf_(
     LAPACK_INTEGER*          INFO
 );
 
-extern void dgetri_(
+extern void dgetrs_(
+    LAPACK_CHARACTER*        TRANS,
     LAPACK_INTEGER*          N,
+    LAPACK_INTEGER*          NRHS,
     LAPACK_DOUBLE_PRECISION* A,
     LAPACK_INTEGER*          LDA,
     LAPACK_INTEGER*          IPIV,
-    LAPACK_DOUBLE_PRECISION* WORK,
-    LAPACK_INTEGER*          LWORK,
+    LAPACK_DOUBLE_PRECISION* B,
+    LAPACK_INTEGER*          LDB,
     LAPACK_INTEGER*          INFO
 );
-
-extern void dgemv_(
-    LAPACK_CHARACTER*        TRANS,
-    LAPACK_INTEGER*          M,
-    LAPACK_INTEGER*          N,
-    LAPACK_DOUBLE_PRECISION* ALPHA,
-    LAPACK_DOUBLE_PRECISION* A,
-    LAPACK_INTEGER*          LDA,
-    LAPACK_DOUBLE_PRECISION* X,
-    LAPACK_INTEGER*          INCX,
-    LAPACK_DOUBLE_PRECISION* BETA,
-    LAPACK_DOUBLE_PRECISION* Y,
-    LAPACK_INTEGER*          INCY
-);
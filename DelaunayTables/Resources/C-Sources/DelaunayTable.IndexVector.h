@@ -52,6 +52,13 @@ extern int IndexVector__append(
     const size_t index
 );
 
+/// Remove all elements, the capacity is kept
+static inline void IndexVector__clear(
+    IndexVector* const this
+) {
+    this->size = 0;
+}
+
 extern void IndexVector__sort(
     IndexVector* this
 );
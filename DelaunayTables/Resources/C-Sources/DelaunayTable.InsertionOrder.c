@@ -0,0 +1,206 @@
+#include "DelaunayTable.InsertionOrder.h"
+
+#include <stdlib.h>
+
+
+/// Seed of the shuffle in `InsertionOrder__brio`
+static const uint64_t brioSeed = 0x5DEECE66DULL;
+
+/// Rounds smaller than this are merged into the first round
+static const size_t brioMinimumRoundSize = 64;
+
+
+/// # Static functions
+typedef struct {
+    uint64_t key;
+    size_t   index;
+} KeyAndIndex;
+
+static int KeyAndIndex__compare(
+    const void* const a,
+    const void* const b
+) {
+    const KeyAndIndex* const ka = (const KeyAndIndex*) a;
+    const KeyAndIndex* const kb = (const KeyAndIndex*) b;
+    if      (ka->key   < kb->key  ) {return -1;}
+    else if (ka->key   > kb->key  ) {return +1;}
+    else if (ka->index < kb->index) {return -1;}
+    else if (ka->index > kb->index) {return +1;}
+    else                            {return  0;}
+}
+
+/// splitmix64
+static uint64_t InsertionOrder__random(
+    uint64_t* const state
+) {
+    uint64_t z = ((*state) += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static void InsertionOrder__shuffle(
+    const size_t nKeys,
+    KeyAndIndex* const keys
+) {
+    uint64_t state = brioSeed;
+    for (size_t i = nKeys ; i > 1 ; i--) {
+        const size_t j = (size_t) (InsertionOrder__random(&state) % i);
+
+        const KeyAndIndex swap = keys[i-1];
+        keys[i-1] = keys[j];
+        keys[j]   = swap;
+    }
+}
+
+
+/// # InsertionOrder functions
+uint64_t hilbertIndex(
+    const size_t nDim,
+    const size_t nBits,
+    uint64_t* const axes
+) {
+    /*
+     * J. Skilling, "Programming the Hilbert curve",
+     * AIP Conference Proceedings 707, 381 (2004)
+     */
+    const uint64_t M = ((uint64_t) 1) << (nBits-1);
+
+    // Inverse undo
+    for (uint64_t Q = M ; Q > 1 ; Q >>= 1) {
+        const uint64_t P = Q - 1;
+        for (size_t i = 0 ; i < nDim ; i++) {
+            if (axes[i] & Q) {
+                axes[0] ^= P;
+            } else {
+                const uint64_t t = (axes[0] ^ axes[i]) & P;
+                axes[0] ^= t;
+                axes[i] ^= t;
+            }
+        }
+    }
+
+    // Gray encode
+    for (size_t i = 1 ; i < nDim ; i++) {
+        axes[i] ^= axes[i-1];
+    }
+    uint64_t t = 0;
+    for (uint64_t Q = M ; Q > 1 ; Q >>= 1) {
+        if (axes[nDim-1] & Q) {t ^= Q - 1;}
+    }
+    for (size_t i = 0 ; i < nDim ; i++) {
+        axes[i] ^= t;
+    }
+
+    // Interleave transposed bits
+    uint64_t index = 0;
+    for (size_t iBit = nBits ; iBit > 0 ; iBit--) {
+        for (size_t i = 0 ; i < nDim ; i++) {
+            index = (index << 1) | ((axes[i] >> (iBit-1)) & 1);
+        }
+    }
+
+    return index;
+}
+
+int InsertionOrder__arrange(
+    const enum InsertionOrder insertionOrder,
+    const size_t nDim,
+    const size_t pointBegin,
+    const size_t pointEnd,
+    const Points points,
+    Points__get_coordinates* const get_coordinates,
+    size_t* const order
+) {
+    const size_t nPoints = pointEnd - pointBegin;
+
+    if (insertionOrder != InsertionOrder__brio && insertionOrder != InsertionOrder__hilbert) {
+        for (size_t i = 0 ; i < nPoints ; i++) {
+            order[i] = pointBegin + i;
+        }
+        return SUCCESS;
+    }
+
+    int status = SUCCESS;
+
+    // nAxes * nBits <= 64 and nBits <= 32
+    const size_t nAxes = (nDim  < 64) ? nDim        : 64;
+    const size_t nBits = (nAxes >  2) ? 64 / nAxes  : 32;
+
+    double*      lower = NULL;  // double[nDim]
+    double*      upper = NULL;  // double[nDim]
+    uint64_t*    axes  = NULL;  // uint64_t[nDim]
+    KeyAndIndex* keys  = NULL;  // KeyAndIndex[nPoints]
+
+    if (!(lower = (double*)      MALLOC(nDim    * sizeof(double))))      {status = FAILURE; goto finally;}
+    if (!(upper = (double*)      MALLOC(nDim    * sizeof(double))))      {status = FAILURE; goto finally;}
+    if (!(axes  = (uint64_t*)    MALLOC(nDim    * sizeof(uint64_t))))    {status = FAILURE; goto finally;}
+    if (!(keys  = (KeyAndIndex*) MALLOC(nPoints * sizeof(KeyAndIndex)))) {status = FAILURE; goto finally;}
+
+    // Bounding box of points
+    for (size_t i = 0 ; i < nDim ; i++) {
+        lower[i] = +HUGE_VAL;
+        upper[i] = -HUGE_VAL;
+    }
+    for (size_t iPoint = pointBegin ; iPoint < pointEnd ; iPoint++) {
+        const double* const coordinates = get_coordinates(points, iPoint);
+        for (size_t i = 0 ; i < nDim ; i++) {
+            if (coordinates[i] < lower[i]) {lower[i] = coordinates[i];}
+            if (coordinates[i] > upper[i]) {upper[i] = coordinates[i];}
+        }
+    }
+
+    // Hilbert index of quantized coordinates
+    const double maxAxis = (double) ((((uint64_t) 1) << nBits) - 1);
+    for (size_t iPoint = pointBegin ; iPoint < pointEnd ; iPoint++) {
+        const double* const coordinates = get_coordinates(points, iPoint);
+        for (size_t i = 0 ; i < nAxes ; i++) {
+            const double width = upper[i] - lower[i];
+            axes[i] = (width > 0.0)
+                ? (uint64_t) (maxAxis * ((coordinates[i] - lower[i]) / width))
+                : 0;
+        }
+
+        keys[iPoint - pointBegin].key   = hilbertIndex(nAxes, nBits, axes);
+        keys[iPoint - pointBegin].index = iPoint;
+    }
+
+    if (insertionOrder == InsertionOrder__hilbert) {
+        qsort(keys, nPoints, sizeof(KeyAndIndex), KeyAndIndex__compare);
+    } else {
+        /**
+         * Biased randomized insertion order
+         * - shuffle all points
+         * - the last round has the latter half of points, the previous round
+         *   has the half of the rest, ...
+         * - points in each round are sorted along the hilbert curve
+         */
+        InsertionOrder__shuffle(nPoints, keys);
+
+        for (size_t roundEnd = nPoints ; roundEnd > 0 ;) {
+            const size_t roundBegin = (roundEnd > brioMinimumRoundSize) ? roundEnd / 2 : 0;
+
+            qsort(
+                keys + roundBegin,
+                roundEnd - roundBegin,
+                sizeof(KeyAndIndex),
+                KeyAndIndex__compare
+            );
+
+            roundEnd = roundBegin;
+        }
+    }
+
+    for (size_t i = 0 ; i < nPoints ; i++) {
+        order[i] = keys[i].index;
+    }
+
+finally:
+
+    if (lower) {FREE(lower);}
+    if (upper) {FREE(upper);}
+    if (axes)  {FREE(axes);}
+    if (keys)  {FREE(keys);}
+
+    return status;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "DelaunayTable.Geometry.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/// # InsertionOrder
+enum InsertionOrder {
+    InsertionOrder__raw = 1,  /// order of the table buffer
+    InsertionOrder__brio,     /// biased randomized insertion order, hilbert sorted in each round
+    InsertionOrder__hilbert   /// sorted along a hilbert curve (used for batched queries)
+};
+
+
+/// ## InsertionOrder functions
+/**
+ * Arrange point indices `[pointBegin, pointEnd)` into `order` by `insertionOrder`.
+ * `order` has `pointEnd - pointBegin` elements.
+ *
+ * `InsertionOrder__brio` shuffles points by a fixed seed, splits them into rounds
+ * of doubling size and sorts each round along a hilbert curve,
+ * so the result is reproducible.
+ * `InsertionOrder__hilbert` sorts all points along the hilbert curve without rounds.
+ */
+extern int InsertionOrder__arrange(
+    const enum InsertionOrder insertionOrder,
+    const size_t nDim,
+    const size_t pointBegin,
+    const size_t pointEnd,
+    const Points points,
+    Points__get_coordinates* get_coordinates,
+    size_t* order
+);
+
+/**
+ * Index along the hilbert curve of `nDim` dimension.
+ * Each element of `axes` is quantized coordinate of `nBits` bits,
+ * `nDim * nBits` must not exceed 64.
+ * `axes` is overwritten.
+ */
+extern uint64_t hilbertIndex(
+    const size_t nDim,
+    const size_t nBits,
+    uint64_t* axes
+);
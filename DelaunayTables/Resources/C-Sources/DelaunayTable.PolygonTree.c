@@ -3,175 +3,318 @@
 
 #include "DelaunayTable.Error.h"
 #include "DelaunayTable.IndexVector.h"
+#include "DelaunayTable.FaceHashMap.h"
+#include "DelaunayTable.Predicates.h"
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 
-/// # FaceVector
-typedef Vector FaceVector;
+/// ## PolygonTreeVector static functions
+/// Index of `vertex` in `polygon`, `nVerticesInPolygon(nDim)` if not found
+static inline size_t PolygonTreeVector__vertex_index(
+    const PolygonTreeVector* const this,
+    const size_t polygon,
+    const size_t vertex
+) {
+    const size_t* const vertices = PolygonTreeVector__vertices(this, polygon);
+
+    size_t i = 0;
+    while (i < nVerticesInPolygon(this->nDim) && vertices[i] != vertex) {i++;}
+
+    return i;
+}
 
-static FaceVector* FaceVector__new(
-    const size_t size
+/// Index of the face of `polygon` shared with `neighbor`
+static inline size_t PolygonTreeVector__neighbor_index(
+    const PolygonTreeVector* const this,
+    const size_t polygon,
+    const size_t neighbor
 ) {
-    return Vector__new(
-        size,
-        sizeof(IndexVector*)
-    );
+    const size_t* const neighbors = PolygonTreeVector__neighbors(this, polygon);
+
+    size_t i = 0;
+    while (i < nVerticesInPolygon(this->nDim) && neighbors[i] != neighbor) {i++;}
+
+    return i;
+}
+
+/// Number of doubles of a cached circumsphere, see `PolygonTreeVector`
+static inline size_t PolygonTreeVector__sphereSize(
+    const size_t nDim
+) {
+    return nDim + 2;
 }
 
-static inline IndexVector** FaceVector__elements(
-    const FaceVector* const this
+static inline double* PolygonTreeVector__sphere(
+    const PolygonTreeVector* const this,
+    const size_t polygon
 ) {
-    return Vector__elements(this, IndexVector*);
+    return this->spheres + polygon * PolygonTreeVector__sphereSize(this->nDim);
 }
 
-static void FaceVector__delete(
-    FaceVector* const this
+/// Let `polygon` (may be `noPolygon`) refer `neighbor_new` instead of `neighbor_old`
+static int PolygonTreeVector__replace_neighbor(
+    PolygonTreeVector* const this,
+    const size_t polygon,
+    const size_t neighbor_old,
+    const size_t neighbor_new
 ) {
-    for (size_t i = 0 ; i < (this->size) ; i++) {
-        IndexVector__delete(FaceVector__elements(this)[i]);
-    }
+    if (polygon == noPolygon) {return SUCCESS;}
+
+    const size_t i = PolygonTreeVector__neighbor_index(this, polygon, neighbor_old);
+    if (i == nVerticesInPolygon(this->nDim)) {return FAILURE;}
+
+    PolygonTreeVector__neighbors(this, polygon)[i] = neighbor_new;
+
+    return SUCCESS;
+}
+
+/// Set neighbor of `polygon` across the face opposite to `vertex`
+static int PolygonTreeVector__set_neighbor(
+    PolygonTreeVector* const this,
+    const size_t polygon,
+    const size_t vertex,
+    const size_t neighbor
+) {
+    const size_t i = PolygonTreeVector__vertex_index(this, polygon, vertex);
+    if (i == nVerticesInPolygon(this->nDim)) {return FAILURE;}
 
-    Vector__delete(this);
+    PolygonTreeVector__neighbors(this, polygon)[i] = neighbor;
+
+    return SUCCESS;
 }
 
-static int FaceVector__append(
-    FaceVector* const this,
-    IndexVector* const face
+static void PolygonTreeVector__send_polygon(
+    const PolygonTreeVector* const this,
+    const char* const prefix,
+    const size_t polygon
 ) {
-    IndexVector* copied = IndexVector__copy(face);
-    if (!copied) {
-        return FAILURE;
+    const size_t nDim = this->nDim;
+    const size_t* const vertices = PolygonTreeVector__vertices(this, polygon);
+
+    char buffer[1024];
+
+    sprintf(buffer, "%s{", prefix);
+    for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
+        sprintf(
+            buffer+strlen(buffer), "%lu%s",
+            vertices[i]+1,
+            (i < (nVerticesInPolygon(nDim)-1)) ? ", " : "}"
+        );
     }
 
-    return Vector__append(
-        this,
-        &copied,
-        sizeof(IndexVector*)
-    );
+    Runtime__send_message(buffer);
 }
 
 
-/// ## PolygonTree methods
-PolygonTree* PolygonTree__new(
+/// ## PolygonTreeVector methods
+/// Block size of `scratch`, an insertion in `nDim` up to 16 fits in one block
+static const size_t PolygonTreeVector__scratchBlockSize = 4 * 1024;
+
+PolygonTreeVector* PolygonTreeVector__new(
     const size_t nDim
 ) {
-    PolygonTree* const this = (PolygonTree*) MALLOC(sizeof(PolygonTree));
+    PolygonTreeVector* const this = (PolygonTreeVector*) MALLOC(sizeof(PolygonTreeVector));
     if (!this) {goto error;}
 
-    this->vertices = NULL;
-    this->children = NULL;
+    this->nDim      = nDim;
+    this->kernels   = GeometryKernels__select(nDim);
+    this->size      = 0;
+    this->capacity  = 1;
+    this->vertices  = NULL;
+    this->neighbors = NULL;
+    this->children  = NULL;
+    this->spheres   = NULL;
+    this->scratch   = NULL;
+    this->polygons  = NULL;
+    this->ridges    = NULL;
+    this->aroundPolygons  = NULL;
+    this->overlapVertices = NULL;
 
     this->vertices = (size_t*) CALLOC(nVerticesInPolygon(nDim), sizeof(size_t));
     if (!(this->vertices)) {goto error;}
 
-    this->children = PolygonTreeVector__new(0);
+    this->neighbors = (size_t*) CALLOC(nVerticesInPolygon(nDim), sizeof(size_t));
+    if (!(this->neighbors)) {goto error;}
+
+    this->children = (size_t*) CALLOC(2, sizeof(size_t));
     if (!(this->children)) {goto error;}
 
+    this->spheres = (double*) CALLOC(PolygonTreeVector__sphereSize(nDim), sizeof(double));
+    if (!(this->spheres)) {goto error;}
+
+    this->scratch = Arena__new(PolygonTreeVector__scratchBlockSize);
+    if (!(this->scratch)) {goto error;}
+
+    this->polygons = IndexVector__new(0);
+    if (!(this->polygons)) {goto error;}
+
+    this->ridges = FaceHashMap__new(nVerticesInFace(nDim));
+    if (!(this->ridges)) {goto error;}
+
+    this->aroundPolygons = IndexVector__new(0);
+    if (!(this->aroundPolygons)) {goto error;}
+
+    this->overlapVertices = IndexVector__new(0);
+    if (!(this->overlapVertices)) {goto error;}
+
     return this;
 
 error:
 
     if (this) {
-        if (this->vertices) FREE(this->vertices);
-        if (this->children) PolygonTreeVector__delete(this->children);
+        if (this->vertices)  FREE(this->vertices);
+        if (this->neighbors) FREE(this->neighbors);
+        if (this->children)  FREE(this->children);
+        if (this->spheres)   FREE(this->spheres);
+        if (this->scratch)   Arena__delete(this->scratch);
+        if (this->polygons)  IndexVector__delete(this->polygons);
+        if (this->ridges)    FaceHashMap__delete(this->ridges);
+        if (this->aroundPolygons)  IndexVector__delete(this->aroundPolygons);
+        if (this->overlapVertices) IndexVector__delete(this->overlapVertices);
         FREE(this);
     }
 
     return NULL;
 }
 
-void PolygonTree__delete(
-    PolygonTree* const this
+void PolygonTreeVector__delete(
+    PolygonTreeVector* const this
 ) {
     FREE(this->vertices);
-    PolygonTreeVector__delete(this->children);
+    FREE(this->neighbors);
+    FREE(this->children);
+    FREE(this->spheres);
+    Arena__delete(this->scratch);
+    IndexVector__delete(this->polygons);
+    FaceHashMap__delete(this->ridges);
+    IndexVector__delete(this->aroundPolygons);
+    IndexVector__delete(this->overlapVertices);
     FREE(this);
 }
 
-void PolygonTree__sort_vertices(
-    const size_t nDim,
-    PolygonTree* const this
+int PolygonTreeVector__append(
+    PolygonTreeVector* const this,
+    const size_t nPolygons
 ) {
-    sort__size_t__Array(this->vertices, nVerticesInPolygon(nDim));
+    const size_t nDim      = this->nDim;
+    const size_t next_size = this->size + nPolygons;
+
+    if (next_size > (this->capacity)) {
+        size_t capacity = this->capacity;
+        while (capacity < next_size) {
+            capacity *= 2;
+        }
+
+        size_t* const vertices = (size_t*) REALLOC(
+            this->vertices, capacity * nVerticesInPolygon(nDim) * sizeof(size_t)
+        );
+        if (!vertices) {return FAILURE;}
+        this->vertices = vertices;
+
+        size_t* const neighbors = (size_t*) REALLOC(
+            this->neighbors, capacity * nVerticesInPolygon(nDim) * sizeof(size_t)
+        );
+        if (!neighbors) {return FAILURE;}
+        this->neighbors = neighbors;
+
+        size_t* const children = (size_t*) REALLOC(
+            this->children, capacity * 2 * sizeof(size_t)
+        );
+        if (!children) {return FAILURE;}
+        this->children = children;
+
+        double* const spheres = (double*) REALLOC(
+            this->spheres, capacity * PolygonTreeVector__sphereSize(nDim) * sizeof(double)
+        );
+        if (!spheres) {return FAILURE;}
+        this->spheres = spheres;
+
+        this->capacity = capacity;
+    }
+
+    for (size_t polygon = this->size ; polygon < next_size ; polygon++) {
+        PolygonTreeVector__set_children(this, polygon, 0, 0);
+        PolygonTreeVector__sphere(this, polygon)[nDim] = NAN;
+    }
+
+    this->size = next_size;
+
+    return SUCCESS;
 }
 
-int PolygonTree__append_child(
-    PolygonTree* const this,
-    PolygonTree* const child
+void PolygonTreeVector__sort_vertices(
+    PolygonTreeVector* const this,
+    const size_t polygon
 ) {
-    return PolygonTreeVector__append(this->children, child);
+    sort__size_t__Array(
+        PolygonTreeVector__vertices(this, polygon),
+        nVerticesInPolygon(this->nDim)
+    );
 }
 
-int PolygonTree__calculate_divisionRatio(
-    const size_t nDim,
-    const PolygonTree* const this,
+int PolygonTreeVector__calculate_divisionRatio(
+    const PolygonTreeVector* const this,
+    const size_t polygon,
     const double* const coordinates,
     const Points points,
     Points__get_coordinates* const get_coordinates,
-    double* const divisionRatio
+    double* const divisionRatio,
+    const double** const shape
 ) {
-    int status = SUCCESS;
-
-    const double** const shape = (const double**) MALLOC(
-        nVerticesInPolygon(nDim) * sizeof(double*)
-    );
-    if (!shape) {status = FAILURE; goto finally;}
+    const size_t nDim = this->nDim;
+    const size_t* const vertices = PolygonTreeVector__vertices(this, polygon);
 
     for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
-        shape[i] = get_coordinates(points, this->vertices[i]);
+        shape[i] = get_coordinates(points, vertices[i]);
     }
 
-    status = divisionRatioFromPolygonVertices(
+    return this->kernels.divisionRatio(
         nDim,
         shape,
         coordinates,
         divisionRatio
     );
-    if (status) {goto finally;}
-
-finally:
-
-    if (shape) {FREE(shape);}
-
-    return status;
 }
 
-int PolygonTree__find(
-    const size_t nDim,
-    PolygonTree* const rootPolygon,
+int PolygonTreeVector__find(
+    const PolygonTreeVector* const this,
+    const size_t rootPolygon,
     const double* const coordinates,
     const Points points,
     Points__get_coordinates* const get_coordinates,
-    PolygonTree** const foundPolygon,
-    double* const divisionRatio
+    size_t* const foundPolygon,
+    double* const divisionRatio,
+    const double** const shape
 ) {
     int status = SUCCESS;
 
-    status = PolygonTree__calculate_divisionRatio(
-        nDim,
+    status = PolygonTreeVector__calculate_divisionRatio(
+        this,
         rootPolygon,
         coordinates,
         points,
         get_coordinates,
-        divisionRatio
+        divisionRatio,
+        shape
     );
     if (status) {
-        *foundPolygon = NULL;
+        *foundPolygon = noPolygon;
         return status;
     }
 
-    // if coordinates not in rootPolygon: SUCCESS, result is NULL
-    if (!divisionRatio__inside(nDim, divisionRatio)) {
-        *foundPolygon = NULL;
+    // if coordinates not in rootPolygon: SUCCESS, result is noPolygon
+    if (!divisionRatio__inside(this->nDim, divisionRatio)) {
+        *foundPolygon = noPolygon;
         return SUCCESS;
     }
 
     // ** coordinates in rootPolygon **
 
     // if rootPolygon does not have children: SUCCESS, result is rootPolygon
-    if (PolygonTree__nChildren(rootPolygon) == 0) {
+    if (PolygonTreeVector__nChildren(this, rootPolygon) == 0) {
         *foundPolygon = rootPolygon;
         return SUCCESS;
     }
@@ -179,145 +322,160 @@ int PolygonTree__find(
     // ** rootPolygon has children **
 
     // if any find(child, ...) success: SUCCESS, return first result
-    for (size_t i = 0 ; i < PolygonTree__nChildren(rootPolygon) ; i++) {
-        status = PolygonTree__find(
-            nDim,
-            PolygonTree__children(rootPolygon)[i],
+    const size_t firstChild = PolygonTreeVector__firstChild(this, rootPolygon);
+    const size_t nChildren  = PolygonTreeVector__nChildren(this, rootPolygon);
+
+    for (size_t child = firstChild ; child < firstChild + nChildren ; child++) {
+        status = PolygonTreeVector__find(
+            this,
+            child,
             coordinates,
             points,
             get_coordinates,
             foundPolygon,
-            divisionRatio
+            divisionRatio,
+            shape
         );
         if (status) {
             return status;
         }
 
-        if (*foundPolygon) return SUCCESS;
+        if (*foundPolygon != noPolygon) return SUCCESS;
     }
 
     // else: failure
-    *foundPolygon = NULL;
+    *foundPolygon = noPolygon;
+    return FAILURE;
+}
+
+int PolygonTreeVector__walk(
+    const PolygonTreeVector* const this,
+    const size_t startPolygon,
+    const double* const coordinates,
+    const Points points,
+    Points__get_coordinates* const get_coordinates,
+    const size_t maxSteps,
+    size_t* const foundPolygon,
+    double* const divisionRatio,
+    const double** const shape
+) {
+    int status = SUCCESS;
+
+    const size_t nDim = this->nDim;
+
+    *foundPolygon = noPolygon;
+
+    /**
+     * Stochastic visibility walk
+     * - Move to the neighbor across a face which separates `coordinates` from the polygon.
+     * - The face is chosen by pseudo random order of vertices,
+     *   which prevents the walk from cycling.
+     */
+    uint64_t randomState = 0;
+    size_t polygon = startPolygon;
+
+    for (size_t step = 0 ; step <= maxSteps ; step++) {
+        status = PolygonTreeVector__calculate_divisionRatio(
+            this,
+            polygon,
+            coordinates,
+            points,
+            get_coordinates,
+            divisionRatio,
+            shape
+        );
+        if (status) {return status;}
+
+        randomState = randomState * 6364136223846793005ULL + 1442695040888963407ULL;
+        const size_t offset = (size_t) (randomState >> 33) % nVerticesInPolygon(nDim);
+
+        size_t iEx = nVerticesInPolygon(nDim);
+        for (size_t j = 0 ; j < nVerticesInPolygon(nDim) ; j++) {
+            const size_t i = (j + offset) % nVerticesInPolygon(nDim);
+            if (double__compare(divisionRatio[i], 0.0) < 0) {
+                iEx = i; break;
+            }
+        }
+
+        // if coordinates in polygon: SUCCESS, result is polygon
+        if (iEx == nVerticesInPolygon(nDim)) {
+            *foundPolygon = polygon;
+            return SUCCESS;
+        }
+
+        // Move across the face opposite to `vertices[iEx]`
+        const size_t next = PolygonTreeVector__neighbors(this, polygon)[iEx];
+
+        // if coordinates outside all polygons: SUCCESS, result is noPolygon
+        if (next == noPolygon) {
+            return SUCCESS;
+        }
+
+        polygon = next;
+    }
+
+    // walk does not terminate: failure
     return FAILURE;
 }
 
-int PolygonTree__get_around(
-    const size_t nDim,
-    const PolygonTree* const polygon,
+int PolygonTreeVector__get_around(
+    const PolygonTreeVector* const this,
+    const size_t polygon,
     const IndexVector* const overlapVertices,
-    const NeighborPairMap* const neighborPairMap,
-    PolygonTreeVector* const aroundPolygons
+    IndexVector* const aroundPolygons
 ) {
     // Early return
     for (size_t i = 0 ; i < (aroundPolygons->size) ; i++) {
-        if (polygon == PolygonTreeVector__elements(aroundPolygons)[i]) {
+        if (polygon == IndexVector__elements(aroundPolygons)[i]) {
             return SUCCESS;
         }
     }
 
     int status = SUCCESS;
 
-    // resources
-    IndexVector* face = IndexVector__new(nVerticesInFace(nDim));
-    if (!face) {
-        status = FAILURE; goto finally;
-    }
+    const size_t nDim = this->nDim;
 
-    status = PolygonTreeVector__append(
+    status = IndexVector__append(
         aroundPolygons,
-        (PolygonTree*) polygon
+        polygon
     );
     if (status) {
-        goto finally;
+        return status;
     }
 
-    for (size_t iEx = 0 ; iEx < nVerticesInPolygon(nDim) ; iEx++) {
-        for (size_t i = 0 ; i < nVerticesInFace(nDim) ; i++) {
-            if (i < iEx) {
-                IndexVector__elements(face)[i] = polygon->vertices[i+0];
-            } else {
-                IndexVector__elements(face)[i] = polygon->vertices[i+1];
-            }
-        }
+    const size_t* const vertices = PolygonTreeVector__vertices(this, polygon);
 
-        if (!contains__size_t__Array(
-            nVerticesInFace(nDim), IndexVector__elements(face),
-            overlapVertices->size, IndexVector__elements(overlapVertices)
+    // Move across faces which contain all `overlapVertices`
+    for (size_t iEx = 0 ; iEx < nVerticesInPolygon(nDim) ; iEx++) {
+        if (contains__size_t__Array(
+            overlapVertices->size, IndexVector__elements(overlapVertices),
+            1                    , &vertices[iEx]
         )) {
             continue;
         }
 
-        Neighbor* neighborPair;
-        if (!NeighborPairMap__get(neighborPairMap, face, &neighborPair)) {
-            status = FAILURE; goto finally;
-        }
+        const size_t candidate = PolygonTreeVector__neighbors(this, polygon)[iEx];
+        if (candidate == noPolygon) {continue;}
 
-        for (size_t i = 0 ; i < 2 ; i++) {
-            PolygonTree* candidate = neighborPair[i].polygon;
-            if (candidate && candidate != polygon) {
-                status = PolygonTree__get_around(
-                    nDim,
-                    candidate,
-                    overlapVertices,
-                    neighborPairMap,
-                    aroundPolygons
-                );
-                if (status) {
-                    goto finally;
-                }
-            }
+        status = PolygonTreeVector__get_around(
+            this,
+            candidate,
+            overlapVertices,
+            aroundPolygons
+        );
+        if (status) {
+            return status;
         }
     }
 
-finally:
-
-    if (face) {IndexVector__delete(face);}
-
-    return status;
-}
-
-
-/// ## PolygonTreeVector methods
-PolygonTreeVector* PolygonTreeVector__new(
-    const size_t size
-) {
-    return Vector__new(size, sizeof(PolygonTree*));
-}
-
-void PolygonTreeVector__delete(
-    PolygonTreeVector* const this
-) {
-    Vector__delete(this);
-}
-
-void PolygonTreeVector__delete_elements(
-    PolygonTreeVector* const this
-) {
-    for (size_t i = 0 ; i < (this->size) ; i++) {
-        PolygonTree__delete(PolygonTreeVector__elements(this)[i]);
-    }
-}
-
-int PolygonTreeVector__append(
-    PolygonTreeVector* const this,
-    PolygonTree* polygon
-) {
-    return Vector__append(
-        this,
-        &polygon,
-        sizeof(PolygonTree*)
-    );
+    return SUCCESS;
 }
 
 static int PolygonTreeVector__divide_polygon_inside(
-    const size_t nDim,
     PolygonTreeVector* this,
-    PolygonTree* const polygonToDivide,
+    const size_t polygonToDivide,
     const size_t pointToDivide,
-    const Points points,
-    Points__get_coordinates* const get_coordinates,
-    NeighborPairMap* const neighborPairMap,
-    FaceVector* const faceVector,
+    IndexVector* const polygonsToFlip,
     const enum Verbosity verbosity
 ) {
     if (verbosity >= Verbosity__debug) {
@@ -326,12 +484,18 @@ static int PolygonTreeVector__divide_polygon_inside(
 
     int status = SUCCESS;
 
-    const size_t previousPolygonVectorSize = this->size;
+    const size_t nDim       = this->nDim;
+    const size_t newPolygon = this->size;
 
-    IndexVector* face = IndexVector__new(nVerticesInFace(nDim));
-    if (!face) {
-        status = FAILURE; goto finally;
-    }
+    status = PolygonTreeVector__append(this, nVerticesInPolygon(nDim));
+    if (status) {return status;}
+
+    PolygonTreeVector__set_children(
+        this, polygonToDivide, newPolygon, nVerticesInPolygon(nDim)
+    );
+
+    const size_t* const dividedVertices  = PolygonTreeVector__vertices (this, polygonToDivide);
+    const size_t* const dividedNeighbors = PolygonTreeVector__neighbors(this, polygonToDivide);
 
     /**
      * Add new polygons.
@@ -340,148 +504,70 @@ static int PolygonTreeVector__divide_polygon_inside(
      * - `nDim` vertices are selected from the `nDim+1` vertices in `polygonToDivide`.
      */
     for (size_t iEx = 0 ; iEx < nVerticesInPolygon(nDim) ; iEx++) {
-        // Alloc polygon & append PolygonTreeVector
-        PolygonTree* const polygon = PolygonTree__new(nDim);
-        if (!polygon) {
-            status = FAILURE; goto finally;
-        }
-
-        status = PolygonTreeVector__append(
-            this, polygon
-        );
-        if (status) {
-            PolygonTree__delete(polygon);
-            goto finally;
-        }
-
-        status = PolygonTree__append_child(
-            polygonToDivide,
-            polygon
-        );
-        if (status) {
-            goto finally;
-        }
+        size_t* const vertices = PolygonTreeVector__vertices(this, newPolygon + iEx);
 
         // Set vertices of polygon
         for (size_t i = 0 ; i < (nVerticesInPolygon(nDim)-1) ; i++) {
             if (i < iEx) {
-                polygon->vertices[i] = polygonToDivide->vertices[i+0];
+                vertices[i] = dividedVertices[i+0];
             } else {
-                polygon->vertices[i] = polygonToDivide->vertices[i+1];
+                vertices[i] = dividedVertices[i+1];
             }
         }
-        polygon->vertices[nVerticesInPolygon(nDim)-1] = pointToDivide;
+        vertices[nVerticesInPolygon(nDim)-1] = pointToDivide;
 
-        PolygonTree__sort_vertices(nDim, polygon);
+        PolygonTreeVector__sort_vertices(this, newPolygon + iEx);
 
         if (verbosity >= Verbosity__debug) {
-            char buffer[1024];
-
-            sprintf(buffer, "- - - Append new polygon {");
-            for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
-                sprintf(
-                    buffer+strlen(buffer), "%lu%s",
-                    polygon->vertices[i]+1,
-                    (i < (nVerticesInPolygon(nDim)-1)) ? ", " : "}"
-                );
-            }
-
-            Runtime__send_message(buffer);
+            PolygonTreeVector__send_polygon(
+                this, "- - - Append new polygon ", newPolygon + iEx
+            );
         }
     }
 
-    PolygonTree** const newPolygons = PolygonTreeVector__elements(this) + previousPolygonVectorSize;
-
     /**
-     * Add new faces inside `polygonToDivide`
-     * Each new face has `nDim` vertices.
-     * - One vertex is `pointToDivide`.
-     * - `nDim-1` vertices are selected from the `nDim+1` vertices in `polygonToDivide`.
+     * Set neighbors of new polygons
+     * - Across the face opposite to `pointToDivide`,
+     *   the neighbor of `polygonToDivide` refers the new polygon instead.
+     * - Across the face opposite to the other vertex,
+     *   the neighbor is the new polygon which excludes the vertex.
      */
-    for (size_t iEx_a = 0       ; iEx_a < nVerticesInPolygon(nDim) ; iEx_a++)
-    for (size_t iEx_b = iEx_a+1 ; iEx_b < nVerticesInPolygon(nDim) ; iEx_b++)
-    {
-        // Set vertices of face
-        for (size_t i = 0 ; i < (nVerticesInFace(nDim)-1) ; i++) {
-            if (i+0 < iEx_a) {
-                IndexVector__elements(face)[i] = polygonToDivide->vertices[i+0];
-            } else if (i+1 < iEx_b) {
-                IndexVector__elements(face)[i] = polygonToDivide->vertices[i+1];
-            } else {
-                IndexVector__elements(face)[i] = polygonToDivide->vertices[i+2];
-            }
-        }
-        IndexVector__elements(face)[nVerticesInFace(nDim)-1] = pointToDivide;
-
-        IndexVector__sort(face);
+    for (size_t iEx = 0 ; iEx < nVerticesInPolygon(nDim) ; iEx++) {
+        const size_t polygon = newPolygon + iEx;
 
-        // Set to neighborPairMap
-        Neighbor neighborPair[2] = {
-            {polygonToDivide->vertices[iEx_a], newPolygons[iEx_b]},
-            {polygonToDivide->vertices[iEx_b], newPolygons[iEx_a]}
-        };
+        status = PolygonTreeVector__set_neighbor(
+            this, polygon, pointToDivide, dividedNeighbors[iEx]
+        );
+        if (status) {return status;}
 
-        status = NeighborPairMap__set(
-            neighborPairMap,
-            face,
-            neighborPair
+        status = PolygonTreeVector__replace_neighbor(
+            this, dividedNeighbors[iEx], polygonToDivide, polygon
         );
-        if (status) {goto finally;}
-    }
+        if (status) {return status;}
 
-    /**
-     * Update faces outside `polygonToDivide`
-     * Each face has `nDim` vertices.
-     * - `nDim` vertices are selected from the `nDim+1` vertices in `polygonToDivide`.
-     */
-    for (size_t iEx = 0 ; iEx < nVerticesInPolygon(nDim) ; iEx++) {
-        // Set vertices of face
-        for (size_t i = 0 ; i < nVerticesInFace(nDim) ; i++) {
-            if (i < iEx) {
-                IndexVector__elements(face)[i] = polygonToDivide->vertices[i+0];
-            } else {
-                IndexVector__elements(face)[i] = polygonToDivide->vertices[i+1];
-            }
-        }
+        for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
+            if (i == iEx) {continue;}
 
-        // Update neighborPairMap
-        status = NeighborPairMap__update_by_opposite(
-            neighborPairMap,
-            face,
-            polygonToDivide->vertices[iEx],  // opposite_old
-            pointToDivide,                   // opposite_new
-            newPolygons[iEx]                 // polygon_new
-        );
-        if (status) {
-            goto finally;
+            status = PolygonTreeVector__set_neighbor(
+                this, polygon, dividedVertices[i], newPolygon + i
+            );
+            if (status) {return status;}
         }
 
-        status = FaceVector__append(
-            faceVector,
-            face
-        );
-        if (status) {
-            goto finally;
-        }
+        // The face opposite to `pointToDivide` may be flipped
+        status = IndexVector__append(polygonsToFlip, polygon);
+        if (status) {return status;}
     }
 
-finally:
-
-    if (face) {IndexVector__delete(face);}
-
-    return status;
+    return SUCCESS;
 }
 
 static int PolygonTreeVector__divide_polygon_by_face(
-    const size_t nDim,
     PolygonTreeVector* const this,
-    PolygonTree* const polygonToDivide,
+    const size_t polygonToDivide,
     const size_t pointToDivide,
-    const double* divisionRatio,
-    const Points points,
-    Points__get_coordinates* const get_coordinates,
-    NeighborPairMap* const neighborPairMap,
-    FaceVector* const faceVector,
+    const int* sides,
+    IndexVector* const polygonsToFlip,
     const enum Verbosity verbosity
 ) {
     if (verbosity >= Verbosity__debug) {
@@ -490,35 +576,21 @@ static int PolygonTreeVector__divide_polygon_by_face(
 
     int status = SUCCESS;
 
-    const size_t previousPolygonVectorSize = this->size;
-
-    // Resources
-    PolygonTreeVector* aroundPolygons  = NULL;
-    IndexVector*       overlapVertices = NULL;
-    IndexVector*       face            = NULL;
-    bool*              faceChecked     = NULL;
-
-    aroundPolygons = PolygonTreeVector__new(0);
-    if (!aroundPolygons) {
-        status = FAILURE; goto finally;
-    }
+    const size_t nDim       = this->nDim;
+    const size_t newPolygon = this->size;
 
-    overlapVertices = IndexVector__new(0);
-    if (!overlapVertices) {
-        status = FAILURE; goto finally;
-    }
+    IndexVector* const aroundPolygons  = this->aroundPolygons;
+    IndexVector* const overlapVertices = this->overlapVertices;
 
-    face = IndexVector__new(nVerticesInFace(nDim));
-    if (!face) {
-        status = FAILURE; goto finally;
-    }
+    IndexVector__clear(aroundPolygons);
+    IndexVector__clear(overlapVertices);
 
     // Get `overlapVertices`
     for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
-        if (double__compare(divisionRatio[i], 0.0) != 0) {
+        if (sides[i] != 0) {
             status = IndexVector__append(
                 overlapVertices,
-                polygonToDivide->vertices[i]
+                PolygonTreeVector__vertices(this, polygonToDivide)[i]
             );
             if (status) {
                 goto finally;
@@ -527,11 +599,10 @@ static int PolygonTreeVector__divide_polygon_by_face(
     }
 
     // Get `aroundPolygons`
-    status = PolygonTree__get_around(
-        nDim,
+    status = PolygonTreeVector__get_around(
+        this,
         polygonToDivide,
         overlapVertices,
-        neighborPairMap,
         aroundPolygons
     );
     if (status) {
@@ -548,26 +619,18 @@ static int PolygonTreeVector__divide_polygon_by_face(
         );
 
         for (size_t iAround = 0 ; iAround < nAroundPolygons ; iAround++) {
-            const PolygonTree* const aroundPolygon
-                = PolygonTreeVector__elements(aroundPolygons)[iAround];
+            char prefix[64];
+            sprintf(prefix, "- - - - aroundPolygon[%2lu] ", iAround+1);
 
-            char buffer[1024];
-            sprintf(
-                buffer, "- - - - aroundPolygon[%2lu] {",
-                iAround+1
+            PolygonTreeVector__send_polygon(
+                this, prefix, IndexVector__elements(aroundPolygons)[iAround]
             );
-            for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
-                sprintf(
-                    buffer+strlen(buffer), "%lu%s",
-                    aroundPolygon->vertices[i]+1,
-                    (i < (nVerticesInPolygon(nDim)-1)) ? ", " : "}"
-                );
-            }
-
-            Runtime__send_message(buffer);
         }
     }
 
+    status = PolygonTreeVector__append(this, nAroundPolygons * nOverlapVertices);
+    if (status) {goto finally;}
+
     /**
      * Add new polygons.
      * Repeat new polygons creation for all `aroundPolygon` in `aroundPolygons`.
@@ -577,268 +640,268 @@ static int PolygonTreeVector__divide_polygon_by_face(
      * - - `nDim+1-nOverlapVertices` vertices are selected from non-overlap vertices of `aroundPolygon`.
      */
     for (size_t iAround = 0 ; iAround < nAroundPolygons ; iAround++) {
-        PolygonTree* const aroundPolygon
-            = PolygonTreeVector__elements(aroundPolygons)[iAround];
-
-        for (size_t iEx = 0 ; iEx < nOverlapVertices ; iEx++) {
-            // Allocate polygon & append PolygonTrees Vector
-            PolygonTree* polygon = PolygonTree__new(nDim);
-            if (!polygon) {
-                status = FAILURE; goto finally;
-            }
+        const size_t aroundPolygon = IndexVector__elements(aroundPolygons)[iAround];
+        const size_t* const aroundVertices = PolygonTreeVector__vertices(this, aroundPolygon);
 
-            status = PolygonTreeVector__append(
-                this,
-                polygon
-            );
-            if (status) {
-                PolygonTree__delete(polygon);
-                goto finally;
-            }
+        PolygonTreeVector__set_children(
+            this, aroundPolygon, newPolygon + iAround * nOverlapVertices, nOverlapVertices
+        );
 
-            status = PolygonTree__append_child(
-                aroundPolygon,
-                polygon
-            );
-            if (status) {
-                goto finally;
-            }
+        for (size_t iEx = 0 ; iEx < nOverlapVertices ; iEx++) {
+            const size_t polygon = newPolygon + iAround * nOverlapVertices + iEx;
+            size_t* const vertices = PolygonTreeVector__vertices(this, polygon);
 
             // Set vertices of polygon
             const size_t vertexToExclude = IndexVector__elements(overlapVertices)[iEx];
 
             size_t offset = 0;
             for (size_t i = 0 ; i < (nVerticesInPolygon(nDim)-1) ; i++) {
-                if (aroundPolygon->vertices[i+offset] == vertexToExclude) {
+                if (aroundVertices[i+offset] == vertexToExclude) {
                     offset++;
                 }
-                polygon->vertices[i] = aroundPolygon->vertices[i+offset];;
+                vertices[i] = aroundVertices[i+offset];
             }
-            polygon->vertices[nVerticesInPolygon(nDim)-1] = pointToDivide;
+            vertices[nVerticesInPolygon(nDim)-1] = pointToDivide;
 
-            PolygonTree__sort_vertices(nDim, polygon);
+            PolygonTreeVector__sort_vertices(this, polygon);
 
             if (verbosity >= Verbosity__debug) {
-                char buffer[1024];
-
-                sprintf(buffer, "- - - Append new polygon {");
-                for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
-                    sprintf(
-                        buffer+strlen(buffer), "%lu%s",
-                        polygon->vertices[i]+1,
-                        (i < (nVerticesInPolygon(nDim)-1)) ? ", " : "}"
-                    );
-                }
-
-                Runtime__send_message(buffer);
+                PolygonTreeVector__send_polygon(
+                    this, "- - - Append new polygon ", polygon
+                );
             }
         }
     }
 
-    PolygonTree** const newPolygons = PolygonTreeVector__elements(this) + previousPolygonVectorSize;
-
     /**
-     * Add new faces inside polygon
+     * Set neighbors of new polygons
+     * The new polygon excluding `overlapVertices[iEx]` from `aroundPolygon` has neighbors
+     * - across the face opposite to `pointToDivide`:
+     *   the neighbor of `aroundPolygon` across the face opposite to `overlapVertices[iEx]`,
+     *   which refers the new polygon instead.
+     * - across the face opposite to the other overlap vertex:
+     *   the new polygon excluding the vertex from `aroundPolygon`.
+     * - across the face opposite to a non-overlap vertex:
+     *   the new polygon excluding `overlapVertices[iEx]` from the neighbor of `aroundPolygon`
+     *   across the face opposite to the vertex, which is also in `aroundPolygons`.
      */
-    const size_t nFaces = nAroundPolygons * nOverlapVertices * nVerticesInPolygon(nDim);
-    faceChecked = (bool*) CALLOC(nFaces, sizeof(bool));
-    if (!faceChecked) {
-        status = FAILURE; goto finally;
-    }
+    for (size_t iAround = 0 ; iAround < nAroundPolygons  ; iAround++)
+    for (size_t iEx     = 0 ; iEx     < nOverlapVertices ; iEx++    ) {
+        const size_t aroundPolygon = IndexVector__elements(aroundPolygons)[iAround];
+        const size_t* const aroundVertices  = PolygonTreeVector__vertices (this, aroundPolygon);
+        const size_t* const aroundNeighbors = PolygonTreeVector__neighbors(this, aroundPolygon);
 
-    for (size_t iFace_a = 0 ; iFace_a < nFaces ; iFace_a++) {
-        if (faceChecked[iFace_a]) {continue;}
+        const size_t polygon = newPolygon + iAround * nOverlapVertices + iEx;
+        const size_t vertexToExclude = IndexVector__elements(overlapVertices)[iEx];
 
-        size_t iPolygon_a = iFace_a / nVerticesInPolygon(nDim);
-        size_t iEx_a      = iFace_a % nVerticesInPolygon(nDim);
+        for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
+            size_t vertex = aroundVertices[i];
 
-        PolygonTree* polygon_a = newPolygons[iPolygon_a];
-        size_t opposite_a = polygon_a->vertices[iEx_a];
+            size_t neighbor;
+            if (vertex == vertexToExclude) {
+                neighbor = aroundNeighbors[i];
 
-        if (opposite_a == pointToDivide) {continue;}
+                status = PolygonTreeVector__replace_neighbor(
+                    this, neighbor, aroundPolygon, polygon
+                );
+                if (status) {goto finally;}
 
-        for (size_t i = 0 ; i < nVerticesInFace(nDim) ; i++) {
-            if (i < iEx_a) {
-                IndexVector__elements(face)[i] = polygon_a->vertices[i+0];
+                vertex = pointToDivide;
             } else {
-                IndexVector__elements(face)[i] = polygon_a->vertices[i+1];
-            }
-        };
-
-        for (size_t iFace_b = iFace_a+1 ; iFace_b < nFaces ; iFace_b++) {
-            size_t iPolygon_b = iFace_b / nVerticesInPolygon(nDim);
-            size_t iEx_b      = iFace_b % nVerticesInPolygon(nDim);
-
-            PolygonTree* polygon_b = newPolygons[iPolygon_b];
-            size_t opposite_b = polygon_b->vertices[iEx_b];
-
-            if (contains__size_t__Array(
-                nVerticesInFace(nDim), IndexVector__elements(face),
-                1                    , &opposite_b
-            )) {continue;}
-
-            if (!contains__size_t__Array(
-                nVerticesInPolygon(nDim), polygon_b->vertices,
-                nVerticesInFace(nDim)   , IndexVector__elements(face)
-            )) {continue;}
+                size_t iOverlap = 0;
+                while (
+                    iOverlap < nOverlapVertices &&
+                    IndexVector__elements(overlapVertices)[iOverlap] != vertex
+                ) {iOverlap++;}
+
+                if (iOverlap < nOverlapVertices) {
+                    neighbor = newPolygon + iAround * nOverlapVertices + iOverlap;
+                } else if (aroundNeighbors[i] == noPolygon) {
+                    neighbor = noPolygon;
+                } else {
+                    size_t iNeighbor = 0;
+                    while (
+                        iNeighbor < nAroundPolygons &&
+                        IndexVector__elements(aroundPolygons)[iNeighbor] != aroundNeighbors[i]
+                    ) {iNeighbor++;}
 
-            faceChecked[iFace_b] = true;
+                    if (iNeighbor == nAroundPolygons) {
+                        status = FAILURE; goto finally;
+                    }
 
-            Neighbor neighborPair[2] = {
-                {opposite_a, polygon_a},
-                {opposite_b, polygon_b}
-            };
+                    neighbor = newPolygon + iNeighbor * nOverlapVertices + iEx;
+                }
+            }
 
-            status = NeighborPairMap__set(
-                neighborPairMap, face, neighborPair
-            );
+            status = PolygonTreeVector__set_neighbor(this, polygon, vertex, neighbor);
             if (status) {goto finally;}
         }
-    }
-
-    /**
-     * Update faces outside polygon
-     * Repeat face update for all `aroundPolygon` in `aroundPolygons`.
-     * - Each face has `nDim` vertices.
-     * - - `nOverlapVertices-1`      vertices are selected from the vertices in `overlapVertices`.
-     * - - `nDim+1-nOverlapVertices` vertices are selected from non-overlap vertices of `aroundPolygon`.
-     */
-    for (size_t iAround = 0 ; iAround < nAroundPolygons  ; iAround++)
-    for (size_t iEx     = 0 ; iEx     < nOverlapVertices ; iEx++    ) {
-        PolygonTree* const newPolygon = newPolygons[iAround * nOverlapVertices + iEx];
-        const size_t vertexToUpdate = IndexVector__elements(overlapVertices)[iEx];
-
-        // Set vertices of face
-        size_t offset = 0;
-        for (size_t i = 0 ; i < nVerticesInFace(nDim) ; i++) {
-            if (newPolygon->vertices[i+offset] == pointToDivide) {
-                offset++;
-            }
-            IndexVector__elements(face)[i] = newPolygon->vertices[i+offset];
-        }
 
-        // Update neighbor
-        status = NeighborPairMap__update_by_opposite(
-            neighborPairMap,
-            face,
-            vertexToUpdate,
-            pointToDivide,
-            newPolygon
-        );
-        if (status) {
-            goto finally;
-        }
+        // The face opposite to `pointToDivide` may be flipped
+        status = IndexVector__append(polygonsToFlip, polygon);
+        if (status) {goto finally;}
     }
 
 finally:
 
-    if (aroundPolygons)  {PolygonTreeVector__delete(aroundPolygons);}
-    if (overlapVertices) {IndexVector__delete(overlapVertices);}
-    if (face)            {IndexVector__delete(face);}
-    if (faceChecked)     {FREE(faceChecked);}
-
     return status;
 }
 
-static int Face__is_valid(
-    const IndexVector* const face,
-    const NeighborPairMap* const neighborPairMap,
-    const Points points,
-    Points__get_coordinates* get_coordinates,
-    bool* const validFace
+/**
+ * Cache the circumsphere of the polygon of `shape` into `sphere`, see `PolygonTreeVector`.
+ * The error bound of the center c follows from the forward error of LU with partial pivoting,
+ *   |dc| <= n 2^(n+2) eps cond(E) |c|,  cond(E) <= |E|_F^n / |det E|
+ * for the edge matrix E, it is infinite for (nearly) flat polygons.
+ */
+static void PolygonTreeVector__cache_sphere(
+    const PolygonTreeVector* const this,
+    const double* const* const shape,  // coordinates of vertices of the polygon
+    double* const sphere
 ) {
-    int status = SUCCESS;
+    const size_t nDim = this->nDim;
 
-    const size_t nDim = face->size;
-
-    *validFace = false;
-
-    const double** shape = NULL;
-
-    Neighbor* neighborPair;
-    if (!NeighborPairMap__get(neighborPairMap, face, &neighborPair)) {
-        status = FAILURE; goto finally;
+    double determinant;
+    if (this->kernels.circumcenter(nDim, shape, sphere, &determinant) || !(determinant > 0.0)) {
+        sphere[nDim]   = 0.0;
+        sphere[nDim+1] = INFINITY;
+        return;
     }
-    if (!neighborPair[0].polygon || !neighborPair[1].polygon) {
-        *validFace = true;
-        goto finally;
+
+    double radius2 = 0.0;
+    double edges2  = 0.0;
+    for (size_t i = 0 ; i < nDim ; i++) {
+        radius2 += sphere[i] * sphere[i];
+        for (size_t j = 0 ; j < nDim ; j++) {
+            const double edge = shape[i+1][j] - shape[0][j];
+            edges2 += edge * edge;
+        }
     }
 
-    shape = (const double**) MALLOC(
-        nVerticesInPolygon(nDim) * sizeof(double*)
-    );
-    if (!shape) {
-        status = FAILURE; goto finally;
+    double condition = 1.0 / determinant;
+    for (size_t i = 0 ; i < nDim ; i++) {
+        condition *= sqrt(edges2);
     }
 
-    const PolygonTree* const polygon = neighborPair[0].polygon;
+    const double radius = sqrt(radius2);
+    const double error  = (double) (nDim << (nDim + 2)) * DBL_EPSILON * condition * radius;
 
-    for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
-        shape[i] = get_coordinates(points, polygon->vertices[i]);
-    }
+    sphere[nDim]   = radius2;
+    sphere[nDim+1] = (error < 0.5 * radius) ? error : INFINITY;
+}
 
-    const double* point = get_coordinates(points, neighborPair[1].opposite);
+/**
+ * Whether `point` is inside the circumsphere of `polygon` (exact, see `Predicates__insphere`).
+ * The cached circumsphere decides unless `point` is near the sphere within its error bound,
+ * it is same as the exact predicate then.
+ */
+static int PolygonTreeVector__inside_circumsphere(
+    PolygonTreeVector* const this,
+    const size_t polygon,
+    const size_t point,
+    const Points points,
+    Points__get_coordinates* const get_coordinates,
+    const double** const shape,  // const double*[nDim+1], work area
+    bool* const inside
+) {
+    const size_t nDim = this->nDim;
 
-    bool insideCircumsphere;
+    const size_t* const vertices = PolygonTreeVector__vertices(this, polygon);
+    double*       const sphere   = PolygonTreeVector__sphere(this, polygon);
 
-    status = insideCircumsphereOfPolygon(
-        nDim,
-        shape,
-        point,
-        &insideCircumsphere
-    );
-    if (status) {
-        goto finally;
+    for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
+        shape[i] = get_coordinates(points, vertices[i]);
     }
 
-    *validFace = !insideCircumsphere;
+    if (isnan(sphere[nDim])) {
+        PolygonTreeVector__cache_sphere(this, shape, sphere);
+    }
 
-finally:
+    /**
+     * p := Q - P0, c := C - P0 (cached)
+     * With the error dc of c, |p - c|^2 - |c|^2 is off by 2 dc.p from the exact value,
+     * and by rounding errors relative to |p - c|^2 + |c|^2 + |p|^2.
+     */
+    const double* const coordinates = get_coordinates(points, point);
+
+    double distance2 = 0.0;
+    double relative2 = 0.0;
+    for (size_t i = 0 ; i < nDim ; i++) {
+        const double relative = coordinates[i] - shape[0][i];
+        distance2 += (relative - sphere[i]) * (relative - sphere[i]);
+        relative2 += relative * relative;
+    }
 
-    if (shape) {FREE(shape);}
+    const double radius2 = sphere[nDim];
+    const double margin  = (
+        2.0 * sphere[nDim+1] * sqrt(relative2) +
+        (double) (8 * (nDim + 2)) * DBL_EPSILON * (distance2 + radius2 + relative2)
+    );
 
-    return status;
+    if (distance2 < radius2 - margin) {*inside = true;  return SUCCESS;}
+    if (distance2 > radius2 + margin) {*inside = false; return SUCCESS;}
+
+    return Predicates__insphere(
+        nDim, shape, vertices, coordinates, point, inside
+    );
 }
 
 static int PolygonTreeVector__flip_face(
-    const size_t nDim,
     PolygonTreeVector* const this,
-    const IndexVector* faceToFlip,
+    const size_t polygonToFlip,
     const size_t pointToDivide,
     const Points points,
     Points__get_coordinates* get_coordinates,
-    NeighborPairMap* const neighborPairMap,
-    FaceVector* faceVector,
+    IndexVector* const polygonsToFlip,
+    const double** const shape,  // const double*[nDim+1], work area
+    size_t* const faceToFlip,    // size_t[nDim], work area
     const enum Verbosity verbosity
 ) {
     int status = SUCCESS;
 
-    const size_t previousPolygonVectorSize = this->size;
+    const size_t nDim       = this->nDim;
+    const size_t newPolygon = this->size;
 
-    IndexVector* face = NULL;
+    // Early return (polygon is already flipped)
+    if (PolygonTreeVector__nChildren(this, polygonToFlip) > 0) {goto finally;}
 
-    // Early return (check face is valid)
-    bool validFace;
+    /**
+     * The face to flip is the face of `polygonToFlip` opposite to `pointToDivide`,
+     * `oppositePolygon` is across the face and `oppositeVertex` is its vertex opposite to the face.
+     */
+    const size_t iPoint = PolygonTreeVector__vertex_index(this, polygonToFlip, pointToDivide);
+    if (iPoint == nVerticesInPolygon(nDim)) {
+        status = FAILURE; goto finally;
+    }
 
-    status = Face__is_valid(
-        faceToFlip,
-        neighborPairMap,
-        points,
-        get_coordinates,
-        &validFace
-    );
-    if (status)    {goto finally;}
-    if (validFace) {goto finally;}
+    const size_t oppositePolygon = PolygonTreeVector__neighbors(this, polygonToFlip)[iPoint];
+
+    // Early return (check face is valid)
+    if (oppositePolygon == noPolygon) {goto finally;}
 
-    face = IndexVector__new(nVerticesInFace(nDim));
-    if (!face) {
+    const size_t iOpposite = PolygonTreeVector__neighbor_index(this, oppositePolygon, polygonToFlip);
+    if (iOpposite == nVerticesInPolygon(nDim)) {
         status = FAILURE; goto finally;
     }
 
-    Neighbor* neighborPairToFlip = NULL;
+    const size_t oppositeVertex = PolygonTreeVector__vertices(this, oppositePolygon)[iOpposite];
 
-    if (!NeighborPairMap__get(neighborPairMap, faceToFlip, &neighborPairToFlip)) {
-        status = FAILURE; goto finally;
+    bool insideCircumsphere;
+
+    status = PolygonTreeVector__inside_circumsphere(
+        this,
+        polygonToFlip,
+        oppositeVertex,
+        points,
+        get_coordinates,
+        shape,
+        &insideCircumsphere
+    );
+    if (status)               {goto finally;}
+    if (!insideCircumsphere) {goto finally;}
+
+    // Face to flip: vertices of `polygonToFlip` except `pointToDivide`
+    for (size_t i = 0 ; i < nVerticesInFace(nDim) ; i++) {
+        faceToFlip[i] = PolygonTreeVector__vertices(this, polygonToFlip)[(i < iPoint) ? i : i+1];
     }
 
     if (verbosity >= Verbosity__debug) {
@@ -848,17 +911,11 @@ static int PolygonTreeVector__flip_face(
         for (size_t i = 0 ; i < nVerticesInFace(nDim) ; i++) {
             sprintf(
                 buffer+strlen(buffer), "%lu%s",
-                IndexVector__elements(faceToFlip)[i]+1,
+                faceToFlip[i]+1,
                 (i < (nVerticesInFace(nDim)-1)) ? ", " : "}"
             );
         }
 
-        const size_t oppositeVertex = (
-            (pointToDivide == neighborPairToFlip[1].opposite)
-            ? neighborPairToFlip[0].opposite
-            : neighborPairToFlip[1].opposite
-        );
-
         sprintf(
             buffer+strlen(buffer), " (opposite is %lu)",
             oppositeVertex+1
@@ -867,165 +924,325 @@ static int PolygonTreeVector__flip_face(
         Runtime__send_message(buffer);
     }
 
+    status = PolygonTreeVector__append(this, nVerticesInFace(nDim));
+    if (status) {goto finally;}
+
+    // Both polygons of the face are replaced by the same new polygons
+    PolygonTreeVector__set_children(this, polygonToFlip  , newPolygon, nVerticesInFace(nDim));
+    PolygonTreeVector__set_children(this, oppositePolygon, newPolygon, nVerticesInFace(nDim));
+
     /**
      * Add new polygons.
      * Each new polygon has `nDim+1` vertices.
-     * - One vertex is `opposite0`.
-     * - One vertex in `opposite1`.
-     * - `nDim-1` vertices are selected from the `nDim` vertices in `faceToSplit`.
+     * - One vertex is `pointToDivide`.
+     * - One vertex in `oppositeVertex`.
+     * - `nDim-1` vertices are selected from the `nDim` vertices in `faceToFlip`.
      */
     for (size_t iEx = 0 ; iEx < nVerticesInFace(nDim) ; iEx++) {
-        // Alloc polygon & append PolygonTreeVector
-        PolygonTree* const polygon = PolygonTree__new(nDim);
-        if (!polygon) {
-            status = FAILURE; goto finally;
-        }
-
-        status = PolygonTreeVector__append(
-            this, polygon
-        );
-        if (status) {
-            PolygonTree__delete(polygon);
-            goto finally;
-        }
-
-        for (size_t i = 0 ; i < 2 ; i++) {
-            status = PolygonTree__append_child(
-                neighborPairToFlip[i].polygon,
-                polygon
-            );
-            if (status) {
-                goto finally;
-            }
-        }
+        size_t* const vertices = PolygonTreeVector__vertices(this, newPolygon + iEx);
 
         // Set vertices of polygon
         for (size_t i = 0 ; i < (nVerticesInFace(nDim)-1) ; i++) {
             if (i < iEx) {
-                polygon->vertices[i] = IndexVector__elements(faceToFlip)[i+0];
+                vertices[i] = faceToFlip[i+0];
             } else {
-                polygon->vertices[i] = IndexVector__elements(faceToFlip)[i+1];
+                vertices[i] = faceToFlip[i+1];
             }
         }
-        polygon->vertices[nVerticesInPolygon(nDim)-2] = neighborPairToFlip[0].opposite;
-        polygon->vertices[nVerticesInPolygon(nDim)-1] = neighborPairToFlip[1].opposite;
+        vertices[nVerticesInPolygon(nDim)-2] = pointToDivide;
+        vertices[nVerticesInPolygon(nDim)-1] = oppositeVertex;
 
-        PolygonTree__sort_vertices(nDim, polygon);
+        PolygonTreeVector__sort_vertices(this, newPolygon + iEx);
 
         if (verbosity >= Verbosity__debug) {
-            char buffer[1024];
+            PolygonTreeVector__send_polygon(
+                this, "- - - Append new polygon ", newPolygon + iEx
+            );
+        }
+    }
 
-            sprintf(buffer, "- - - Append new polygon {");
-            for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
-                sprintf(
-                    buffer+strlen(buffer), "%lu%s",
-                    polygon->vertices[i]+1,
-                    (i < (nVerticesInPolygon(nDim)-1)) ? ", " : "}"
-                );
-            }
+    /**
+     * Set neighbors of new polygons
+     * The new polygon excluding `faceToFlip[iEx]` has neighbors
+     * - across the face opposite to `oppositeVertex` (or `pointToDivide`):
+     *   the neighbor of `polygonToFlip` (or `oppositePolygon`)
+     *   across the face opposite to `faceToFlip[iEx]`, which refers the new polygon instead.
+     * - across the face opposite to the other vertex in `faceToFlip`:
+     *   the new polygon excluding the vertex.
+     */
+    for (size_t iEx = 0 ; iEx < nVerticesInFace(nDim) ; iEx++) {
+        const size_t polygon = newPolygon + iEx;
+
+        const size_t oldPolygons[2] = {polygonToFlip , oppositePolygon};
+        const size_t oppositeTo [2] = {oppositeVertex, pointToDivide  };
+
+        for (size_t iOld = 0 ; iOld < 2 ; iOld++) {
+            const size_t iVertex = PolygonTreeVector__vertex_index(
+                this, oldPolygons[iOld], faceToFlip[iEx]
+            );
+            const size_t neighbor = PolygonTreeVector__neighbors(this, oldPolygons[iOld])[iVertex];
+
+            status = PolygonTreeVector__set_neighbor(
+                this, polygon, oppositeTo[iOld], neighbor
+            );
+            if (status) {goto finally;}
+
+            status = PolygonTreeVector__replace_neighbor(
+                this, neighbor, oldPolygons[iOld], polygon
+            );
+            if (status) {goto finally;}
+        }
+
+        for (size_t i = 0 ; i < nVerticesInFace(nDim) ; i++) {
+            if (i == iEx) {continue;}
 
-            Runtime__send_message(buffer);
+            status = PolygonTreeVector__set_neighbor(
+                this, polygon, faceToFlip[i], newPolygon + i
+            );
+            if (status) {goto finally;}
         }
     }
 
-    PolygonTree** const newPolygons = PolygonTreeVector__elements(this) + previousPolygonVectorSize;
+    // Faces opposite to `pointToDivide` of new polygons may be flipped
+    for (size_t iEx = 0 ; iEx < nVerticesInFace(nDim) ; iEx++) {
+        status = IndexVector__append(polygonsToFlip, newPolygon + iEx);
+        if (status) {goto finally;}
+    }
+
+finally:
+
+    return status;
+}
+
+/**
+ * Walk from `*polygon` to the current polygon which contains `point` by exact orientations.
+ * `sides[i]` is the side of `point` from the face opposite to `vertices[i]`,
+ * +1 (inside) or 0 (on the face).
+ * Starting from the polygon located by tolerant division ratios, it rarely moves.
+ */
+static int PolygonTreeVector__locate_exact(
+    const PolygonTreeVector* const this,
+    size_t* const polygon,
+    const size_t point,
+    const Points points,
+    Points__get_coordinates* const get_coordinates,
+    const double** const shape,  // const double*[nDim+1], work area
+    int* const sides             // int[nDim+1]
+) {
+    int status = SUCCESS;
+
+    const size_t nDim = this->nDim;
+
+    for (size_t step = 0 ; step <= (this->size) ; step++) {
+        const size_t* const vertices = PolygonTreeVector__vertices(this, *polygon);
+
+        for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
+            shape[i] = get_coordinates(points, vertices[i]);
+        }
+
+        int orientation;
+        status = Predicates__orientation(nDim, shape, &orientation);
+        if (status)           {return status;}
+        if (orientation == 0) {return FAILURE;}
+
+        size_t iEx = nVerticesInPolygon(nDim);
+        for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
+            shape[i] = get_coordinates(points, point);
+
+            status = Predicates__orientation(nDim, shape, &sides[i]);
+            if (status) {return status;}
+            sides[i] *= orientation;
+
+            shape[i] = get_coordinates(points, vertices[i]);
+
+            if (sides[i] < 0 && iEx == nVerticesInPolygon(nDim)) {iEx = i;}
+        }
+
+        if (iEx == nVerticesInPolygon(nDim)) {return SUCCESS;}
+
+        // Move across the face opposite to `vertices[iEx]`
+        *polygon = PolygonTreeVector__neighbors(this, *polygon)[iEx];
+        if (*polygon == noPolygon) {return FAILURE;}
+    }
+
+    return FAILURE;
+}
+
+static int PolygonTreeVector__divide_cavity(
+    PolygonTreeVector* const this,
+    const size_t polygonToDivide,
+    const size_t pointToDivide,
+    const Points points,
+    Points__get_coordinates* const get_coordinates,
+    const double** const shape,  // const double*[nDim+1], work area
+    size_t* const face,          // size_t[nDim], work area
+    const enum Verbosity verbosity
+) {
+    if (verbosity >= Verbosity__debug) {
+        Runtime__send_message("- - Divide cavity of point");
+    }
+
+    int status = SUCCESS;
+
+    const size_t nDim       = this->nDim;
+    const size_t newPolygon = this->size;
+
+    IndexVector* const cavity = this->polygons;
+    FaceHashMap* const ridges = this->ridges;
+
+    IndexVector__clear(cavity);
+    FaceHashMap__clear(ridges);
 
     /**
-     * Add new faces inside `neighborPairToFlip`
-     * Each new face has `nDim` vertices.
-     * - Two vertex are `opposite` of `neighborPairToFlip`.
-     * - `nDim-2` vertices are selected from the `nDim` vertices in `faceToFlip`.
+     * Cavity: polygons whose circumsphere contains `pointToDivide`,
+     * connected to `polygonToDivide` through their faces (breadth first search).
+     * Polygons in the cavity are marked by children (the new polygons),
+     * the number of children is set after the new polygons are counted.
      */
-    for (size_t iEx_a = 0       ; iEx_a < nVerticesInFace(nDim) ; iEx_a++)
-    for (size_t iEx_b = iEx_a+1 ; iEx_b < nVerticesInFace(nDim) ; iEx_b++) {
-        // Set vertices of face
-        for (size_t i = 0 ; i < nVerticesInFace(nDim)-2 ; i++) {
-            if (i+0 < iEx_a) {
-                IndexVector__elements(face)[i] = IndexVector__elements(faceToFlip)[i+0];
-            } else if (i+1 < iEx_b) {
-                IndexVector__elements(face)[i] = IndexVector__elements(faceToFlip)[i+1];
-            } else {
-                IndexVector__elements(face)[i] = IndexVector__elements(faceToFlip)[i+2];
-            }
+    status = IndexVector__append(cavity, polygonToDivide);
+    if (status) {goto finally;}
+    PolygonTreeVector__set_children(this, polygonToDivide, newPolygon, 1);
+
+    for (size_t iCavity = 0 ; iCavity < (cavity->size) ; iCavity++) {
+        const size_t polygon = IndexVector__elements(cavity)[iCavity];
+
+        for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
+            const size_t neighbor = PolygonTreeVector__neighbors(this, polygon)[i];
+            if (neighbor == noPolygon)                            {continue;}
+            if (PolygonTreeVector__nChildren(this, neighbor) > 0) {continue;}
+
+            bool insideCircumsphere;
+
+            status = PolygonTreeVector__inside_circumsphere(
+                this, neighbor, pointToDivide, points, get_coordinates,
+                shape, &insideCircumsphere
+            );
+            if (status)              {goto finally;}
+            if (!insideCircumsphere) {continue;}
+
+            status = IndexVector__append(cavity, neighbor);
+            if (status) {goto finally;}
+            PolygonTreeVector__set_children(this, neighbor, newPolygon, 1);
         }
-        IndexVector__elements(face)[nVerticesInFace(nDim)-2] = neighborPairToFlip[0].opposite;
-        IndexVector__elements(face)[nVerticesInFace(nDim)-1] = neighborPairToFlip[1].opposite;
+    }
 
-        IndexVector__sort(face);
+    // Boundary faces of the cavity: faces whose neighbor is not in the cavity
+    size_t nNewPolygons = 0;
+    for (size_t iCavity = 0 ; iCavity < (cavity->size) ; iCavity++) {
+        const size_t* const neighbors = PolygonTreeVector__neighbors(
+            this, IndexVector__elements(cavity)[iCavity]
+        );
 
-        // Set to neighborPairMap
-        Neighbor neighborPair[2] = {
-            {IndexVector__elements(faceToFlip)[iEx_a], newPolygons[iEx_b]},
-            {IndexVector__elements(faceToFlip)[iEx_b], newPolygons[iEx_a]}
-        };
+        for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
+            if (
+                neighbors[i] == noPolygon ||
+                PolygonTreeVector__nChildren(this, neighbors[i]) == 0
+            ) {nNewPolygons++;}
+        }
+    }
 
-        status = NeighborPairMap__set(neighborPairMap, face, neighborPair);
-        if (status) {goto finally;}
+    if (verbosity >= Verbosity__detail) {
+        Runtime__send_message(
+            "- - - Find %lu polygons in cavity, %lu boundary faces",
+            cavity->size,
+            nNewPolygons
+        );
     }
 
+    status = PolygonTreeVector__append(this, nNewPolygons);
+    if (status) {goto finally;}
+
     /**
-     * Update faces outside `neighborPairToFlip`
-     * Each new face has `nDim` vertices.
-     * - One vertex is selected from `opposite` of `neighborPairToFlip`.
-     * - `nDim-1` vertices are selected from the `nDim` vertices in `faceToFlip`.
+     * Add new polygons.
+     * Each new polygon has `nDim+1` vertices, a boundary face and `pointToDivide`.
+     * - Across the face opposite to `pointToDivide`,
+     *   the neighbor outside of the cavity refers the new polygon instead.
+     * - Across the other faces (which contain `pointToDivide`),
+     *   the neighbor is the new polygon sharing the face,
+     *   it is matched by the face in `ridges`.
      */
-    for (size_t iNeighbor = 0 ; iNeighbor < 2               ; iNeighbor++) {
-        const bool appendToFaceVector
-            = neighborPairToFlip[iNeighbor].opposite != pointToDivide;
-
-        for (size_t iEx = 0       ; iEx < nVerticesInFace(nDim) ; iEx++) {
-            // Set vertices of face
-            for (size_t i = 0 ; i < (nVerticesInFace(nDim)-1) ; i++) {
-                if (i < iEx) {
-                    IndexVector__elements(face)[i] = IndexVector__elements(faceToFlip)[i+0];
-                } else {
-                    IndexVector__elements(face)[i] = IndexVector__elements(faceToFlip)[i+1];
-                }
+    size_t polygon = newPolygon;
+    for (size_t iCavity = 0 ; iCavity < (cavity->size) ; iCavity++) {
+        const size_t cavityPolygon = IndexVector__elements(cavity)[iCavity];
+
+        PolygonTreeVector__set_children(this, cavityPolygon, newPolygon, nNewPolygons);
+
+        for (size_t iEx = 0 ; iEx < nVerticesInPolygon(nDim) ; iEx++) {
+            const size_t neighbor = PolygonTreeVector__neighbors(this, cavityPolygon)[iEx];
+            if (
+                neighbor != noPolygon &&
+                PolygonTreeVector__nChildren(this, neighbor) > 0
+            ) {continue;}
+
+            // Set vertices of polygon
+            size_t* const vertices = PolygonTreeVector__vertices(this, polygon);
+            for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
+                vertices[i] = (i == iEx)
+                    ? pointToDivide
+                    : PolygonTreeVector__vertices(this, cavityPolygon)[i];
             }
-            IndexVector__elements(face)[nVerticesInFace(nDim)-1]
-                = neighborPairToFlip[iNeighbor].opposite;
-
-            IndexVector__sort(face);
-
-            // Update neighborPairMap
-            status = NeighborPairMap__update_by_opposite(
-                neighborPairMap,
-                face,
-                IndexVector__elements(faceToFlip)[iEx],
-                neighborPairToFlip[1-iNeighbor].opposite,
-                newPolygons[iEx]
-            );
+
+            PolygonTreeVector__sort_vertices(this, polygon);
+
+            if (verbosity >= Verbosity__debug) {
+                PolygonTreeVector__send_polygon(
+                    this, "- - - Append new polygon ", polygon
+                );
+            }
+
+            status = PolygonTreeVector__set_neighbor(this, polygon, pointToDivide, neighbor);
+            if (status) {goto finally;}
+
+            status = PolygonTreeVector__replace_neighbor(this, neighbor, cavityPolygon, polygon);
             if (status) {goto finally;}
 
-            if (appendToFaceVector) {
-                status = FaceVector__append(faceVector, face);
-                if (status) {
-                    goto finally;
+            for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
+                if (vertices[i] == pointToDivide) {continue;}
+
+                // Face opposite to `vertices[i]` (sorted)
+                for (size_t j = 0 ; j < nVerticesInFace(nDim) ; j++) {
+                    face[j] = vertices[(j < i) ? j : j+1];
+                }
+
+                size_t other;
+                if (FaceHashMap__get(ridges, face, &other)) {
+                    const size_t otherPolygon = other / nVerticesInPolygon(nDim);
+                    const size_t otherIndex   = other % nVerticesInPolygon(nDim);
+
+                    PolygonTreeVector__neighbors(this, polygon     )[i]          = otherPolygon;
+                    PolygonTreeVector__neighbors(this, otherPolygon)[otherIndex] = polygon;
+
+                    FaceHashMap__remove(ridges, face);
+                } else {
+                    status = FaceHashMap__set(
+                        ridges, face, polygon * nVerticesInPolygon(nDim) + i
+                    );
+                    if (status) {goto finally;}
                 }
             }
+
+            polygon++;
         }
     }
 
-    // Remove faceToFlip
-    if (!NeighborPairMap__remove(neighborPairMap, faceToFlip)) {
+    // Every face containing `pointToDivide` is shared by two new polygons
+    if (ridges->size > 0) {
         status = FAILURE; goto finally;
     }
 
 finally:
 
-    if (face) {IndexVector__delete(face);}
-
     return status;
 }
 
 void PolygonTreeVector__divide_at_point(
-    const size_t nDim,
     PolygonTreeVector* const this,
     const size_t pointToDivide,
     const Points points,
     Points__get_coordinates* const get_coordinates,
-    PolygonTree* const rootPolygon,
-    NeighborPairMap* const neighborPairMap,
+    const size_t startPolygon,
+    const enum Locator locator,
+    const enum Inserter inserter,
     const enum Verbosity verbosity,
     ResourceStack resources
 ) {
@@ -1033,48 +1250,103 @@ void PolygonTreeVector__divide_at_point(
 
     int status = SUCCESS;
 
-    FaceVector* faceVector = ResourceStack__ensure_delete_finally(
-        resources,
-        FaceVector__new(0),
-        FaceVector__delete
+    const size_t nDim = this->nDim;
+
+    // Work areas are reused by every insertion, nothing is allocated after the first ones
+    Arena__clear(this->scratch);
+
+    IndexVector* const polygonsToFlip = this->polygons;
+    IndexVector__clear(polygonsToFlip);
+
+    double* const divisionRatio = (double*) Arena__allocate(
+        this->scratch, nVerticesInPolygon(nDim) * sizeof(double)
+    );
+
+    const double** const shape = (const double**) Arena__allocate(
+        this->scratch, nVerticesInPolygon(nDim) * sizeof(double*)
+    );
+
+    int* const sides = (int*) Arena__allocate(
+        this->scratch, nVerticesInPolygon(nDim) * sizeof(int)
     );
 
-    double* divisionRatio = ResourceStack__ensure_delete_finally(
-        resources,
-        MALLOC(nVerticesInPolygon(nDim) * sizeof(double)),
-        FREE
+    size_t* const face = (size_t*) Arena__allocate(
+        this->scratch, nVerticesInFace(nDim) * sizeof(size_t)
     );
 
+    if (!divisionRatio || !shape || !sides || !face) {
+        raise_Error(resources, "Arena__allocate(...) failed");
+    }
+
     const double* const coordinatesToDivide
         = get_coordinates(points, pointToDivide);
 
-    PolygonTree* polygonToDivide;
+    size_t polygonToDivide;
 
-    status = PolygonTree__find(
-        nDim,
-        rootPolygon,
-        coordinatesToDivide,
+    if (locator == Locator__history) {
+        status = PolygonTreeVector__find(
+            this,
+            startPolygon,
+            coordinatesToDivide,
+            points,
+            get_coordinates,
+            &polygonToDivide,
+            divisionRatio,
+            shape
+        );
+        if (status) {
+            raise_Error(resources, "PolygonTreeVector__find(...) failed");
+        }
+    } else {
+        status = PolygonTreeVector__walk(
+            this,
+            startPolygon,
+            coordinatesToDivide,
+            points,
+            get_coordinates,
+            this->size,  // maxSteps
+            &polygonToDivide,
+            divisionRatio,
+            shape
+        );
+        if (status) {
+            raise_Error(resources, "PolygonTreeVector__walk(...) failed");
+        }
+    }
+
+    if (polygonToDivide == noPolygon) {
+        raise_Error(resources, "can not find polygonToDivide");
+    }
+
+    // Decisions of division are made by exact predicates
+    status = PolygonTreeVector__locate_exact(
+        this,
+        &polygonToDivide,
+        pointToDivide,
         points,
         get_coordinates,
-        &polygonToDivide,
-        divisionRatio
+        shape,
+        sides
     );
     if (status) {
-        raise_Error(resources, "PolygonTree__find(...) failed");
+        raise_Error(resources, "PolygonTreeVector__locate_exact(...) failed");
     }
 
-    if (!polygonToDivide) {
-        raise_Error(resources, "can not find polygonToDivide");
+    bool onFace = false;
+    for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
+        onFace = onFace || (sides[i] == 0);
     }
 
     if (verbosity >= Verbosity__debug) {
+        const size_t* const vertices = PolygonTreeVector__vertices(this, polygonToDivide);
+
         char buffer[1024];
 
         sprintf(buffer, "- Find polygonToDivide {");
         for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
             sprintf(
                 buffer+strlen(buffer), "%lu%s",
-                polygonToDivide->vertices[i]+1,
+                vertices[i]+1,
                 (i < (nVerticesInPolygon(nDim)-1)) ? ", " : "}"
             );
         }
@@ -1087,32 +1359,38 @@ void PolygonTreeVector__divide_at_point(
         Runtime__send_message(buffer);
     }
 
-    if (!divisionRatio__on_face(nDim, divisionRatio)) {
-        status = PolygonTreeVector__divide_polygon_inside(
-            nDim,
+    if (inserter == Inserter__cavity) {
+        status = PolygonTreeVector__divide_cavity(
             this,
             polygonToDivide,
             pointToDivide,
             points,
             get_coordinates,
-            neighborPairMap,
-            faceVector,
+            shape,
+            face,
+            verbosity
+        );
+        if (status) {
+            raise_Error(resources, "PolygonTreeVector__divide_cavity(...) failed");
+        }
+    } else if (!onFace) {
+        status = PolygonTreeVector__divide_polygon_inside(
+            this,
+            polygonToDivide,
+            pointToDivide,
+            polygonsToFlip,
             verbosity
         );
         if (status) {
             raise_Error(resources, "PolygonTreeVector__divide_polygon_inside(...) failed");
         }
-    } else { // divisionRatio__on_face(...)
+    } else { // onFace
         status = PolygonTreeVector__divide_polygon_by_face(
-            nDim,
             this,
             polygonToDivide,
             pointToDivide,
-            divisionRatio,
-            points,
-            get_coordinates,
-            neighborPairMap,
-            faceVector,
+            sides,
+            polygonsToFlip,
             verbosity
         );
         if (status) {
@@ -1120,16 +1398,16 @@ void PolygonTreeVector__divide_at_point(
         }
     }
 
-    for (size_t i = 0 ; i < (faceVector->size) ; i++) {
+    for (size_t i = 0 ; i < (polygonsToFlip->size) ; i++) {
         status = PolygonTreeVector__flip_face(
-            nDim,
             this,
-            FaceVector__elements(faceVector)[i],
+            IndexVector__elements(polygonsToFlip)[i],
             pointToDivide,
             points,
             get_coordinates,
-            neighborPairMap,
-            faceVector,
+            polygonsToFlip,
+            shape,
+            face,
             verbosity
         );
         if (status) {
@@ -4,122 +4,222 @@
 #include "DelaunayTable.ResourceStack.h"
 #include "DelaunayTable.Geometry.h"
 #include "DelaunayTable.Container.h"
-#include "DelaunayTable.Neighbor.h"
+#include "DelaunayTable.IndexVector.h"
+#include "DelaunayTable.FaceHashMap.h"
+
+
+/// # Locator
+enum Locator {
+    Locator__history = 1,  /// descend the history of divided polygons from the root
+    Locator__walk          /// walk through neighbors of current polygons
+};
+
+
+/// # Inserter
+enum Inserter {
+    Inserter__flip = 1,  /// divide the polygon containing the point, then flip faces
+    Inserter__cavity     /// replace polygons whose circumsphere contains the point (Bowyer-Watson)
+};
+
+
+/// Polygon index which means "no polygon" (outside of all polygons)
+static const size_t noPolygon = (size_t) -1;
+
+
+/** # PolygonTreeVector
+ * All polygons created while dividing, stored as structure of arrays.
+ * Polygons are addressed by their index in the vector.
+ * - `vertices`  : size_t[capacity][nDim+1], sorted in each polygon
+ * - `neighbors` : size_t[capacity][nDim+1], polygon across the face opposite to each vertex
+ * - `children`  : size_t[capacity][2], {first child, number of children}
+ * Children of a polygon are always created at once,
+ * so they are the contiguous range of polygons from the first child.
+ * A polygon without children is current (not divided),
+ * neighbors of current polygons are always current.
+ * `kernels` are the geometry kernels selected for `nDim`.
+ * - `spheres`   : double[capacity][nDim+2], circumsphere cached on the first insphere test,
+ *                 {center relative to the first vertex, squared radius, error bound of center},
+ *                 the squared radius is NaN until computed.
+ * Vertices of a polygon are never changed after it is created (it is replaced by children),
+ * so a cached circumsphere is valid as long as the polygon.
+ * Work areas of `PolygonTreeVector__divide_at_point`, reused by every insertion:
+ * - `scratch`   : fixed size buffers, cleared at the start of each insertion
+ * - `polygons`  : polygons to flip, or polygons in the cavity
+ * - `ridges`    : faces of new polygons waiting for their neighbor
+ * - `aroundPolygons`, `overlapVertices` : polygons and vertices of the face divided by a point on it
+ */
+typedef struct {
+    size_t nDim;
+    GeometryKernels kernels;
+    size_t size;
+    size_t capacity;
+    size_t* vertices;
+    size_t* neighbors;
+    size_t* children;
+    double* spheres;
+    Arena* scratch;
+    IndexVector* polygons;
+    FaceHashMap* ridges;
+    IndexVector* aroundPolygons;
+    IndexVector* overlapVertices;
+} PolygonTreeVector;
 
+/// ## PolygonTreeVector methods
+extern PolygonTreeVector* PolygonTreeVector__new(
+    const size_t nDim
+);
 
-/// # PolygonTree & PolygonTreeVector
-typedef Vector PolygonTreeVector;
+extern void PolygonTreeVector__delete(
+    PolygonTreeVector* this
+);
 
-typedef struct PolygonTree__TAG {
-    size_t* vertices;
-    PolygonTreeVector* children;
-} PolygonTree;
+/**
+ * Append `nPolygons` polygons without children.
+ * The vertices and neighbors are set by the caller,
+ * pointers to vertices and neighbors are invalidated.
+ */
+extern int PolygonTreeVector__append(
+    PolygonTreeVector* this,
+    const size_t nPolygons
+);
 
-/// ## PolygonTree methods
-extern PolygonTree* PolygonTree__new(
-    const size_t nDim
+static inline size_t* PolygonTreeVector__vertices(
+    const PolygonTreeVector* this,
+    const size_t polygon
 );
 
-extern void PolygonTree__delete(
-    PolygonTree* this
+static inline size_t* PolygonTreeVector__neighbors(
+    const PolygonTreeVector* this,
+    const size_t polygon
 );
 
-static inline size_t PolygonTree__nChildren(
-    const PolygonTree* this
+static inline size_t PolygonTreeVector__firstChild(
+    const PolygonTreeVector* this,
+    const size_t polygon
 );
 
-static inline PolygonTree** PolygonTree__children(
-    const PolygonTree* this
+static inline size_t PolygonTreeVector__nChildren(
+    const PolygonTreeVector* this,
+    const size_t polygon
 );
 
-extern void PolygonTree__sort_vertices(
-    const size_t nDim,
-    PolygonTree* this
+static inline void PolygonTreeVector__set_children(
+    PolygonTreeVector* this,
+    const size_t polygon,
+    const size_t firstChild,
+    const size_t nChildren
 );
 
-extern int PolygonTree__append_child(
-    PolygonTree* this,
-    PolygonTree* child
+extern void PolygonTreeVector__sort_vertices(
+    PolygonTreeVector* this,
+    const size_t polygon
 );
 
-extern int PolygonTree__calculate_divisionRatio(
-    const size_t nDim,
-    const PolygonTree* this,
+/// `shape` (const double*[nDim+1]) is a work area of the caller
+extern int PolygonTreeVector__calculate_divisionRatio(
+    const PolygonTreeVector* this,
+    const size_t polygon,
     const double* coordinates,
     const Points points,
     Points__get_coordinates* get_coordinates,
-    double* divisionRatio
+    double* divisionRatio,
+    const double** shape
 );
 
-extern int PolygonTree__find(
-    const size_t nDim,
-    PolygonTree* rootPolygon,
+/**
+ * Find polygon contains `coordinates` by descending children from `rootPolygon`.
+ * If `coordinates` is outside of `rootPolygon`, `foundPolygon` is `noPolygon`.
+ * `shape` is the work area of `PolygonTreeVector__calculate_divisionRatio`.
+ */
+extern int PolygonTreeVector__find(
+    const PolygonTreeVector* this,
+    const size_t rootPolygon,
     const double* coordinates,
     const Points points,
     Points__get_coordinates* get_coordinates,
-    PolygonTree** foundPolygon,
-    double* divisionRatio
-);
-
-extern int PolygonTree__get_around(
-    const size_t nDim,
-    const PolygonTree* polygon,
-    const IndexVector* overlapVertices,
-    const NeighborPairMap* neighborPairMap,
-    PolygonTreeVector* aroundPolygons
-);
-
-
-/// ## PolygonTreeVector methods
-extern PolygonTreeVector* PolygonTreeVector__new(
-    const size_t size
-);
-
-extern void PolygonTreeVector__delete(
-    PolygonTreeVector* this
+    size_t* foundPolygon,
+    double* divisionRatio,
+    const double** shape
 );
 
-extern void PolygonTreeVector__delete_elements(
-    PolygonTreeVector* this
-);
-
-static inline PolygonTree** PolygonTreeVector__elements(
-    const PolygonTreeVector* this
+/**
+ * Find polygon contains `coordinates` by walking through neighbors
+ * from `startPolygon`, which must be a current (not divided) polygon.
+ * If `coordinates` is outside of all polygons, `foundPolygon` is `noPolygon`.
+ * Fails if the walk does not terminate in `maxSteps`.
+ * `shape` is the work area of `PolygonTreeVector__calculate_divisionRatio`.
+ */
+extern int PolygonTreeVector__walk(
+    const PolygonTreeVector* this,
+    const size_t startPolygon,
+    const double* coordinates,
+    const Points points,
+    Points__get_coordinates* get_coordinates,
+    const size_t maxSteps,
+    size_t* foundPolygon,
+    double* divisionRatio,
+    const double** shape
 );
 
-extern int PolygonTreeVector__append(
-    PolygonTreeVector* this,
-    PolygonTree* polygon
+extern int PolygonTreeVector__get_around(
+    const PolygonTreeVector* this,
+    const size_t polygon,
+    const IndexVector* overlapVertices,
+    IndexVector* aroundPolygons
 );
 
+/**
+ * Divide polygons at `pointToDivide` keeping delaunay by `inserter`.
+ * The polygon to divide is searched from `startPolygon` by `locator`.
+ */
 extern void PolygonTreeVector__divide_at_point(
-    const size_t nDim,
     PolygonTreeVector* this,
     const size_t pointToDivide,
     const Points points,
     Points__get_coordinates* get_coordinates,
-    PolygonTree* rootPolygon,
-    NeighborPairMap* neighborPairMap,
+    const size_t startPolygon,
+    const enum Locator locator,
+    const enum Inserter inserter,
     const enum Verbosity verbosity,
     ResourceStack resources
 );
 
 
 /// Declarations of static inline functions
-static inline size_t PolygonTree__nChildren(
-    const PolygonTree* const this
+static inline size_t* PolygonTreeVector__vertices(
+    const PolygonTreeVector* const this,
+    const size_t polygon
+) {
+    return this->vertices + polygon * nVerticesInPolygon(this->nDim);
+}
+
+static inline size_t* PolygonTreeVector__neighbors(
+    const PolygonTreeVector* const this,
+    const size_t polygon
+) {
+    return this->neighbors + polygon * nVerticesInPolygon(this->nDim);
+}
+
+static inline size_t PolygonTreeVector__firstChild(
+    const PolygonTreeVector* const this,
+    const size_t polygon
 ) {
-    return this->children->size;
+    return this->children[2*polygon+0];
 }
 
-static inline PolygonTree** PolygonTree__children(
-    const PolygonTree* const this
+static inline size_t PolygonTreeVector__nChildren(
+    const PolygonTreeVector* const this,
+    const size_t polygon
 ) {
-    return PolygonTreeVector__elements(this->children);
+    return this->children[2*polygon+1];
 }
 
-static inline PolygonTree** PolygonTreeVector__elements(
-    const PolygonTreeVector* this
+static inline void PolygonTreeVector__set_children(
+    PolygonTreeVector* const this,
+    const size_t polygon,
+    const size_t firstChild,
+    const size_t nChildren
 ) {
-    return Vector__elements(this, PolygonTree*);
+    this->children[2*polygon+0] = firstChild;
+    this->children[2*polygon+1] = nChildren;
 }
@@ -0,0 +1,623 @@
+#include "DelaunayTable.Predicates.h"
+
+#include "DelaunayTable.Container.h"
+
+#include <float.h>
+#include <math.h>
+
+
+/// # Expansion arithmetic
+/**
+ * An expansion is a sum of non-overlapping doubles in increasing magnitude,
+ * which represents a real number exactly.
+ * Zero components are eliminated, zero is the expansion {0.0} of length 1.
+ */
+typedef struct {
+    size_t length;
+    double* components;
+} Expansion;
+
+static inline void Expansion__two_sum(
+    const double a,
+    const double b,
+    double* const x,
+    double* const y
+) {
+    *x = a + b;
+    const double b_virtual = *x - a;
+    const double a_virtual = *x - b_virtual;
+    *y = (a - a_virtual) + (b - b_virtual);
+}
+
+static inline void Expansion__two_product(
+    const double a,
+    const double b,
+    double* const x,
+    double* const y
+) {
+    *x = a * b;
+    *y = fma(a, b, -(*x));
+}
+
+/// h = e + f, `h` has `e.length + f.length` components at most
+static size_t Expansion__sum(
+    const Expansion e,
+    const Expansion f,
+    double* const h
+) {
+    size_t ie = 0;
+    size_t jf = 0;
+    size_t length = 0;
+
+    // Merge components of `e` and `f` in increasing magnitude
+    double q = 0.0;
+    while (ie < e.length || jf < f.length) {
+        double next;
+        if (jf == f.length || (ie < e.length && fabs(e.components[ie]) < fabs(f.components[jf]))) {
+            next = e.components[ie++];
+        } else {
+            next = f.components[jf++];
+        }
+
+        double sum, error;
+        Expansion__two_sum(q, next, &sum, &error);
+        if (error != 0.0) {h[length++] = error;}
+        q = sum;
+    }
+
+    if (q != 0.0 || length == 0) {h[length++] = q;}
+
+    return length;
+}
+
+/// h = e * b, `h` has `2 * e.length` components at most
+static size_t Expansion__scale(
+    const Expansion e,
+    const double b,
+    double* const h
+) {
+    size_t length = 0;
+
+    double q, error;
+    Expansion__two_product(e.components[0], b, &q, &error);
+    if (error != 0.0) {h[length++] = error;}
+
+    for (size_t i = 1 ; i < e.length ; i++) {
+        double product1, product0, sum;
+        Expansion__two_product(e.components[i], b, &product1, &product0);
+
+        Expansion__two_sum(q, product0, &sum, &error);
+        if (error != 0.0) {h[length++] = error;}
+
+        Expansion__two_sum(product1, sum, &q, &error);
+        if (error != 0.0) {h[length++] = error;}
+    }
+
+    if (q != 0.0 || length == 0) {h[length++] = q;}
+
+    return length;
+}
+
+static inline int Expansion__sign(
+    const Expansion e
+) {
+    const double top = e.components[e.length - 1];
+    return (top > 0.0) - (top < 0.0);
+}
+
+static Expansion Expansion__from_double(
+    Arena* const arena,
+    const double value
+) {
+    Expansion e = {0, NULL};
+
+    e.components = (double*) Arena__allocate(arena, sizeof(double));
+    if (!e.components) {return e;}
+
+    e.components[0] = value;
+    e.length = 1;
+
+    return e;
+}
+
+/// a - b exactly
+static Expansion Expansion__from_difference(
+    Arena* const arena,
+    const double a,
+    const double b
+) {
+    Expansion e = {0, NULL};
+
+    e.components = (double*) Arena__allocate(arena, 2 * sizeof(double));
+    if (!e.components) {return e;}
+
+    double x, y;
+    Expansion__two_sum(a, -b, &x, &y);
+
+    if (y != 0.0) {e.components[e.length++] = y;}
+    if (x != 0.0 || e.length == 0) {e.components[e.length++] = x;}
+
+    return e;
+}
+
+/// sign * e * f, `sign` is +1 or -1
+static Expansion Expansion__product(
+    Arena* const arena,
+    const Expansion e,
+    const Expansion f,
+    const double sign
+) {
+    Expansion product = {0, NULL};
+
+    const size_t capacity = 2 * e.length * f.length;
+
+    double* const scaled = (double*) Arena__allocate(arena, 2 * e.length * sizeof(double));
+    double* const buffer = (double*) Arena__allocate(arena, 2 * capacity * sizeof(double));
+    if (!scaled || !buffer) {return product;}
+
+    // Sum of `e` scaled by each component of `f`, alternating two buffers
+    Expansion accumulated = {1, buffer};
+    accumulated.components[0] = 0.0;
+
+    for (size_t j = 0 ; j < f.length ; j++) {
+        const Expansion term = {
+            Expansion__scale(e, sign * f.components[j], scaled),
+            scaled
+        };
+
+        double* const next = (accumulated.components == buffer) ? buffer + capacity : buffer;
+        accumulated.length     = Expansion__sum(accumulated, term, next);
+        accumulated.components = next;
+    }
+
+    return accumulated;
+}
+
+
+/// # Determinants
+/// Size of stack buffers of determinants, for matrices up to 8 x 8
+#define Predicates__maxStackMasks (256)
+
+/**
+ * Determinant of `a` (double[n][n], row major) by expansion of minors on column subsets.
+ * `minors[mask]` is the minor of the last `popcount(mask)` rows and the columns in `mask`,
+ * it is expanded along its first row: minor of rows [r, n) and columns S is
+ *   sum of (-1)^t a[r][c] minor(S \ {c}), where c is the t-th column in S.
+ * `*bound` is a rigorous bound of the error, for entries of `a` with
+ * `entryRoundings` roundings at most from exact values.
+ */
+static int Predicates__determinant_filter(
+    const size_t n,
+    const double* const a,
+    const size_t entryRoundings,
+    double* const determinant,
+    double* const bound
+) {
+    // Same expansion in closed form for small matrices
+    if (n == 2) {
+        *determinant = a[0] * a[3] - a[1] * a[2];
+        *bound = (double) (n * n + n * entryRoundings + 2) * DBL_EPSILON * (
+            fabs(a[0] * a[3]) + fabs(a[1] * a[2])
+        );
+        return SUCCESS;
+    }
+
+    if (n == 3) {
+        *determinant = (
+            a[0] * (a[4] * a[8] - a[5] * a[7]) -
+            a[1] * (a[3] * a[8] - a[5] * a[6]) +
+            a[2] * (a[3] * a[7] - a[4] * a[6])
+        );
+        *bound = (double) (n * n + n * entryRoundings + 2) * DBL_EPSILON * (
+            fabs(a[0]) * (fabs(a[4] * a[8]) + fabs(a[5] * a[7])) +
+            fabs(a[1]) * (fabs(a[3] * a[8]) + fabs(a[5] * a[6])) +
+            fabs(a[2]) * (fabs(a[3] * a[7]) + fabs(a[4] * a[6]))
+        );
+        return SUCCESS;
+    }
+
+    if (n == 4) {
+        // Minors of the last two rows, then the last three rows
+        const double s01 = a[ 8] * a[13] - a[ 9] * a[12], p01 = fabs(a[ 8] * a[13]) + fabs(a[ 9] * a[12]);
+        const double s02 = a[ 8] * a[14] - a[10] * a[12], p02 = fabs(a[ 8] * a[14]) + fabs(a[10] * a[12]);
+        const double s03 = a[ 8] * a[15] - a[11] * a[12], p03 = fabs(a[ 8] * a[15]) + fabs(a[11] * a[12]);
+        const double s12 = a[ 9] * a[14] - a[10] * a[13], p12 = fabs(a[ 9] * a[14]) + fabs(a[10] * a[13]);
+        const double s13 = a[ 9] * a[15] - a[11] * a[13], p13 = fabs(a[ 9] * a[15]) + fabs(a[11] * a[13]);
+        const double s23 = a[10] * a[15] - a[11] * a[14], p23 = fabs(a[10] * a[15]) + fabs(a[11] * a[14]);
+
+        const double m123 = a[5] * s23 - a[6] * s13 + a[7] * s12;
+        const double m023 = a[4] * s23 - a[6] * s03 + a[7] * s02;
+        const double m013 = a[4] * s13 - a[5] * s03 + a[7] * s01;
+        const double m012 = a[4] * s12 - a[5] * s02 + a[6] * s01;
+
+        const double q123 = fabs(a[5]) * p23 + fabs(a[6]) * p13 + fabs(a[7]) * p12;
+        const double q023 = fabs(a[4]) * p23 + fabs(a[6]) * p03 + fabs(a[7]) * p02;
+        const double q013 = fabs(a[4]) * p13 + fabs(a[5]) * p03 + fabs(a[7]) * p01;
+        const double q012 = fabs(a[4]) * p12 + fabs(a[5]) * p02 + fabs(a[6]) * p01;
+
+        *determinant = a[0] * m123 - a[1] * m023 + a[2] * m013 - a[3] * m012;
+        *bound = (double) (n * n + n * entryRoundings + 2) * DBL_EPSILON * (
+            fabs(a[0]) * q123 + fabs(a[1]) * q023 + fabs(a[2]) * q013 + fabs(a[3]) * q012
+        );
+        return SUCCESS;
+    }
+
+    const size_t nMasks = (size_t) 1 << n;
+
+    double  stackMinors     [Predicates__maxStackMasks];
+    double  stackPermanents [Predicates__maxStackMasks];
+    double* minors     = stackMinors;
+    double* permanents = stackPermanents;
+
+    if (nMasks > Predicates__maxStackMasks) {
+        minors     = (double*) MALLOC(nMasks * sizeof(double));
+        permanents = (double*) MALLOC(nMasks * sizeof(double));
+        if (!minors || !permanents) {
+            if (minors)     {FREE(minors);}
+            if (permanents) {FREE(permanents);}
+            return FAILURE;
+        }
+    }
+
+    minors    [0] = 1.0;
+    permanents[0] = 1.0;
+
+    // Number of columns in `mask`
+    size_t nColumns = 0;
+
+    for (size_t mask = 1 ; mask < nMasks ; mask++) {
+        // Popcount of `mask` from `mask - 1`: trailing ones are cleared and one bit is set
+        for (size_t bits = mask - 1 ; bits & 1 ; bits >>= 1) {nColumns--;}
+        nColumns++;
+
+        const double* const row = &a[n * (n - nColumns)];
+
+        double minor     = 0.0;
+        double permanent = 0.0;
+        double sign      = 1.0;
+        size_t c = 0;
+        for (size_t bits = mask ; bits ; bits >>= 1, c++) {
+            if (!(bits & 1)) {continue;}
+
+            const size_t sub = mask ^ ((size_t) 1 << c);
+
+            minor     += sign * row[c] * minors[sub];
+            permanent += fabs(row[c]) * permanents[sub];
+            sign = -sign;
+        }
+
+        minors    [mask] = minor;
+        permanents[mask] = permanent;
+    }
+
+    /**
+     * Each of the n! terms is a product of n entries (n-1 multiplications)
+     * accumulated by n nested sums of n terms, so it has n*n roundings at most,
+     * and n*entryRoundings more from entries.
+     * DBL_EPSILON is twice the unit roundoff, which covers the rounding of the bound.
+     */
+    *determinant = minors[nMasks-1];
+    *bound = (double) (n * n + n * entryRoundings + 2) * DBL_EPSILON * permanents[nMasks-1];
+
+    if (nMasks > Predicates__maxStackMasks) {
+        FREE(minors);
+        FREE(permanents);
+    }
+
+    return SUCCESS;
+}
+
+/// Exact sign of the determinant of `a` (Expansion[n][n]), same order as the filter
+static int Predicates__determinant_exact(
+    const size_t n,
+    const Expansion* const a,
+    Arena* const arena,
+    int* const sign
+) {
+    const size_t nMasks = (size_t) 1 << n;
+
+    Expansion* const minors = (Expansion*) Arena__allocate(arena, nMasks * sizeof(Expansion));
+    if (!minors) {return FAILURE;}
+
+    minors[0] = Expansion__from_double(arena, 1.0);
+    if (!minors[0].components) {return FAILURE;}
+
+    for (size_t mask = 1 ; mask < nMasks ; mask++) {
+        size_t nColumns = 0;
+        size_t capacity = 0;
+        for (size_t c = 0 ; c < n ; c++) {nColumns += (mask >> c) & 1;}
+
+        const Expansion* const row = &a[n * (n - nColumns)];
+
+        Expansion minor = Expansion__from_double(arena, 0.0);
+        if (!minor.components) {return FAILURE;}
+
+        size_t t = 0;
+        for (size_t c = 0 ; c < n ; c++) {
+            if (!((mask >> c) & 1)) {continue;}
+
+            const size_t sub = mask ^ ((size_t) 1 << c);
+
+            const Expansion term = Expansion__product(
+                arena, row[c], minors[sub], (t & 1) ? -1.0 : +1.0
+            );
+            if (!term.components) {return FAILURE;}
+
+            capacity = minor.length + term.length;
+
+            double* const sum = (double*) Arena__allocate(arena, capacity * sizeof(double));
+            if (!sum) {return FAILURE;}
+
+            minor.length     = Expansion__sum(minor, term, sum);
+            minor.components = sum;
+            t++;
+        }
+
+        minors[mask] = minor;
+    }
+
+    *sign = Expansion__sign(minors[nMasks-1]);
+
+    return SUCCESS;
+}
+
+/// Size of stack buffers of matrices, for matrices up to 8 x 8
+#define Predicates__maxStackEntries (64)
+
+/// Block size of arenas for exact evaluation
+static const size_t Predicates__arenaBlockSize = 16 * 1024;
+
+
+/// # Predicates
+int Predicates__orientation(
+    const size_t nDim,
+    const double* const* const points,
+    int* const sign
+) {
+    int status = SUCCESS;
+
+    double  stackA[Predicates__maxStackEntries];
+    double* a     = stackA;  // double[nDim][nDim]
+    Arena*  arena = NULL;
+
+    if (nDim * nDim > Predicates__maxStackEntries) {
+        a = (double*) MALLOC(nDim * nDim * sizeof(double));
+        if (!a) {status = FAILURE; goto finally;}
+    }
+
+    for (size_t i = 0 ; i < nDim ; i++)
+    for (size_t j = 0 ; j < nDim ; j++) {
+        a[nDim*i+j] = points[i+1][j] - points[0][j];
+    }
+
+    double determinant, bound;
+    status = Predicates__determinant_filter(nDim, a, 1, &determinant, &bound);
+    if (status) {goto finally;}
+
+    if (fabs(determinant) > bound) {
+        *sign = (determinant > 0.0) ? +1 : -1;
+        goto finally;
+    }
+
+    // Exact evaluation
+    arena = Arena__new(Predicates__arenaBlockSize);
+    if (!arena) {status = FAILURE; goto finally;}
+
+    Expansion* const entries = (Expansion*) Arena__allocate(arena, nDim * nDim * sizeof(Expansion));
+    if (!entries) {status = FAILURE; goto finally;}
+
+    for (size_t i = 0 ; i < nDim ; i++)
+    for (size_t j = 0 ; j < nDim ; j++) {
+        entries[nDim*i+j] = Expansion__from_difference(arena, points[i+1][j], points[0][j]);
+        if (!entries[nDim*i+j].components) {status = FAILURE; goto finally;}
+    }
+
+    status = Predicates__determinant_exact(nDim, entries, arena, sign);
+    if (status) {goto finally;}
+
+finally:
+
+    if (a && a != stackA) {FREE(a);}
+    if (arena) {Arena__delete(arena);}
+
+    return status;
+}
+
+/**
+ * Exact sign of `det[(points[i], 1)]` (i = 0..nDim) excluding `points[excluded]`,
+ * the cofactor of symbolic perturbation of `points[excluded]`.
+ */
+static int Predicates__perturbation_sign(
+    const size_t nDim,
+    const double* const* const points,  // double[nDim+2][nDim]
+    const size_t excluded,
+    Arena* const arena,
+    int* const sign
+) {
+    const size_t n = nVerticesInPolygon(nDim);
+
+    // Entries are exact, the filter decides unless points are on a hyperplane
+    if (n * n <= Predicates__maxStackEntries) {
+        double a[Predicates__maxStackEntries];
+
+        size_t i = 0;
+        for (size_t k = 0 ; k < (n+1) ; k++) {
+            if (k == excluded) {continue;}
+
+            for (size_t j = 0 ; j < nDim ; j++) {
+                a[n*i+j] = points[k][j];
+            }
+            a[n*i+nDim] = 1.0;
+
+            i++;
+        }
+
+        double determinant, bound;
+        if (Predicates__determinant_filter(n, a, 0, &determinant, &bound)) {return FAILURE;}
+
+        if (fabs(determinant) > bound) {
+            *sign = (determinant > 0.0) ? +1 : -1;
+            return SUCCESS;
+        }
+    }
+
+    Expansion* const entries = (Expansion*) Arena__allocate(arena, n * n * sizeof(Expansion));
+    if (!entries) {return FAILURE;}
+
+    size_t i = 0;
+    for (size_t k = 0 ; k < (n+1) ; k++) {
+        if (k == excluded) {continue;}
+
+        for (size_t j = 0 ; j < nDim ; j++) {
+            entries[n*i+j] = Expansion__from_double(arena, points[k][j]);
+            if (!entries[n*i+j].components) {return FAILURE;}
+        }
+        entries[n*i+nDim] = Expansion__from_double(arena, 1.0);
+        if (!entries[n*i+nDim].components) {return FAILURE;}
+
+        i++;
+    }
+
+    return Predicates__determinant_exact(n, entries, arena, sign);
+}
+
+int Predicates__insphere(
+    const size_t nDim,
+    const double* const* const polygon,
+    const size_t*        const polygonVertices,
+    const double*        const point,
+    const size_t               pointIndex,
+    bool* const inside
+) {
+    int status = SUCCESS;
+
+    const size_t n = nVerticesInPolygon(nDim);
+
+    double  stackA[Predicates__maxStackEntries];
+    double* a     = stackA;  // double[nDim+1][nDim+1]
+    Arena*  arena = NULL;
+
+    /**
+     * Orientation of `polygon`
+     * det[(P_i, 1)] (i = 0..nDim) = (-1)^nDim det[P_i - P_0] (i = 1..nDim)
+     */
+    int orientation;
+    status = Predicates__orientation(nDim, polygon, &orientation);
+    if (status) {goto finally;}
+
+    if (orientation == 0) {status = FAILURE; goto finally;}
+    if (nDim % 2 == 1) {orientation = -orientation;}
+
+    /**
+     * D := det[(P_i - Q, |P_i - Q|^2)] (i = 0..nDim)
+     *    = det[(P_i, |P_i|^2, 1); (Q, |Q|^2, 1)]
+     * D is (orientation) * r^2 if Q is the center of the circumsphere,
+     * and changes its sign only on the circumsphere,
+     * so Q is inside of the circumsphere iff D has the sign of orientation.
+     */
+    if (n * n > Predicates__maxStackEntries) {
+        a = (double*) MALLOC(n * n * sizeof(double));
+        if (!a) {status = FAILURE; goto finally;}
+    }
+
+    for (size_t i = 0 ; i < n ; i++) {
+        double norm = 0.0;
+        for (size_t j = 0 ; j < nDim ; j++) {
+            const double relative = polygon[i][j] - point[j];
+            a[n*i+j] = relative;
+            norm += relative * relative;
+        }
+        a[n*i+nDim] = norm;
+    }
+
+    // A squared norm has nDim+1 roundings from exact values, after a rounded difference
+    double determinant, bound;
+    status = Predicates__determinant_filter(n, a, nDim + 2, &determinant, &bound);
+    if (status) {goto finally;}
+
+    if (fabs(determinant) > bound) {
+        *inside = ((determinant > 0.0) ? +1 : -1) == orientation;
+        goto finally;
+    }
+
+    // Exact evaluation
+    arena = Arena__new(Predicates__arenaBlockSize);
+    if (!arena) {status = FAILURE; goto finally;}
+
+    Expansion* const entries = (Expansion*) Arena__allocate(arena, n * n * sizeof(Expansion));
+    if (!entries) {status = FAILURE; goto finally;}
+
+    for (size_t i = 0 ; i < n ; i++) {
+        Expansion norm = Expansion__from_double(arena, 0.0);
+        if (!norm.components) {status = FAILURE; goto finally;}
+
+        for (size_t j = 0 ; j < nDim ; j++) {
+            const Expansion relative = Expansion__from_difference(arena, polygon[i][j], point[j]);
+            if (!relative.components) {status = FAILURE; goto finally;}
+
+            const Expansion square = Expansion__product(arena, relative, relative, +1.0);
+            if (!square.components) {status = FAILURE; goto finally;}
+
+            double* const sum = (double*) Arena__allocate(
+                arena, (norm.length + square.length) * sizeof(double)
+            );
+            if (!sum) {status = FAILURE; goto finally;}
+
+            norm.length     = Expansion__sum(norm, square, sum);
+            norm.components = sum;
+
+            entries[n*i+j] = relative;
+        }
+
+        entries[n*i+nDim] = norm;
+    }
+
+    int sign;
+    status = Predicates__determinant_exact(n, entries, arena, &sign);
+    if (status) {goto finally;}
+
+    /**
+     * Symbolic perturbation
+     * |X_k|^2 of the k-th point in (P_0, .. P_nDim, Q) is lifted by e^(rank of its index),
+     * a point of greater index is lifted more (e is infinitesimal).
+     * D is linear in the lifted column, the coefficient of the lift of X_k is
+     * the cofactor (-1)^(k+nDim) det[(X_i, 1)] (i != k).
+     * The first non-zero cofactor in decreasing order of indices decides the sign,
+     * the cofactor of Q (orientation of polygon) is not zero.
+     */
+    const double** const points  = (const double**) Arena__allocate(arena, (n+1) * sizeof(double*));
+    size_t*        const indices = (size_t*)        Arena__allocate(arena, (n+1) * sizeof(size_t));
+    if (!points || !indices) {status = FAILURE; goto finally;}
+
+    for (size_t k = 0 ; k < n ; k++) {
+        points [k] = polygon[k];
+        indices[k] = polygonVertices[k];
+    }
+    points [n] = point;
+    indices[n] = pointIndex;
+
+    size_t previous = (size_t) -1;
+    while (sign == 0) {
+        // Point of the greatest index less than `previous`
+        size_t k = n+1;
+        for (size_t i = 0 ; i < (n+1) ; i++) {
+            if (indices[i] < previous && (k == n+1 || indices[i] > indices[k])) {k = i;}
+        }
+        if (k == n+1) {status = FAILURE; goto finally;}
+        previous = indices[k];
+
+        status = Predicates__perturbation_sign(nDim, points, k, arena, &sign);
+        if (status) {goto finally;}
+
+        if ((k + nDim) % 2 == 1) {sign = -sign;}
+    }
+
+    *inside = (sign == orientation);
+
+finally:
+
+    if (a && a != stackA) {FREE(a);}
+    if (arena) {Arena__delete(arena);}
+
+    return status;
+}
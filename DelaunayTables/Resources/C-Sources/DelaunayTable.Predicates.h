@@ -0,0 +1,43 @@
+#pragma once
+
+#include "DelaunayTable.Common.h"
+#include "DelaunayTable.Geometry.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+
+/** # Predicates
+ * Exact signs of geometric determinants used for construction decisions.
+ * - A floating point filter evaluates the determinant with a rigorous error bound,
+ *   which decides the sign in the common case.
+ * - Otherwise the determinant is evaluated exactly by floating point expansions
+ *   (sums of non-overlapping doubles, Shewchuk 1997).
+ * - Ties of `Predicates__insphere` are broken by symbolic perturbation of the points,
+ *   so every decision is consistent with a triangulation of perturbed points.
+ * Fails only when memory allocation fails (or on degenerated polygons).
+ */
+
+/**
+ * Sign of `det[points[i] - points[0]]` (i = 1..nDim),
+ * positive if `points` are positively oriented, 0 if they are on a hyperplane.
+ */
+extern int Predicates__orientation(
+    const size_t nDim,
+    const double* const* points,  // double[nDim+1][nDim]
+    int* sign
+);
+
+/**
+ * Whether `point` is inside the circumsphere of `polygon`.
+ * Vertex indices of `polygon` and `pointIndex` order symbolic perturbation,
+ * a point on the circumsphere is decided by them (never on the circumsphere).
+ */
+extern int Predicates__insphere(
+    const size_t nDim,
+    const double* const* polygon,          // double[nDim+1][nDim]
+    const size_t*        polygonVertices,  // size_t[nDim+1]
+    const double*        point,            // double[nDim]
+    const size_t         pointIndex,
+    bool* inside
+);
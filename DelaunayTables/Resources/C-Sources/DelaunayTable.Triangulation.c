@@ -0,0 +1,724 @@
+#include "DelaunayTable.Triangulation.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+
+/// # QueryWorkspace methods
+QueryWorkspace* QueryWorkspace__new(
+    const size_t nDim
+) {
+    void* const buffer = MALLOC(QueryWorkspace__size(nDim));
+    if (!buffer) {return NULL;}
+
+    return QueryWorkspace__on_buffer(nDim, buffer);
+}
+
+void QueryWorkspace__delete(
+    QueryWorkspace* const this
+) {
+    QueryWorkspace__release(this);
+    FREE(this);
+}
+
+size_t QueryWorkspace__size(
+    const size_t nDim
+) {
+    // Arrays follow the header in one block, in the order of alignments
+    return (
+        sizeof(QueryWorkspace) +
+        nVerticesInPolygon(nDim) * sizeof(double) +
+        nDim * nDim              * sizeof(double) +
+        nVerticesInPolygon(nDim) * sizeof(double*) +
+        nVerticesInPolygon(nDim) * sizeof(double*) +
+        nDim                     * sizeof(int)
+    );
+}
+
+QueryWorkspace* QueryWorkspace__on_buffer(
+    const size_t nDim,
+    void* const buffer
+) {
+    QueryWorkspace* const this = (QueryWorkspace*) buffer;
+
+    this->nDim            = nDim;
+    this->divisionRatio   = (double*) (this + 1);
+    this->matrix          = this->divisionRatio + nVerticesInPolygon(nDim);
+    this->shape           = (const double**) (this->matrix + nDim * nDim);
+    this->values          = this->shape + nVerticesInPolygon(nDim);
+    this->ipiv            = (int*) (this->values + nVerticesInPolygon(nDim));
+    this->overlapVertices = NULL;
+    this->aroundPolygons  = NULL;
+
+    return this;
+}
+
+void QueryWorkspace__release(
+    QueryWorkspace* const this
+) {
+    if (this->overlapVertices) {IndexVector__delete(this->overlapVertices);}
+    if (this->aroundPolygons)  {IndexVector__delete(this->aroundPolygons);}
+    this->overlapVertices = NULL;
+    this->aroundPolygons  = NULL;
+}
+
+
+/// # Triangulation methods
+Triangulation* Triangulation__from_polygonTreeVector(
+    const PolygonTreeVector* const polygonTreeVector
+) {
+    const size_t nDim = polygonTreeVector->nDim;
+
+    Triangulation* this = NULL;
+
+    size_t* compactIndex = NULL;
+
+    compactIndex = (size_t*) MALLOC(
+        polygonTreeVector->size * sizeof(size_t)
+    );
+    if (!compactIndex) {goto error;}
+
+    // Current polygons are polygons without children
+    size_t nPolygons = 0;
+    for (size_t i = 0 ; i < (polygonTreeVector->size) ; i++) {
+        compactIndex[i] = (PolygonTreeVector__nChildren(polygonTreeVector, i) == 0)
+            ? nPolygons++
+            : noPolygon;
+    }
+
+    this = (Triangulation*) MALLOC(sizeof(Triangulation));
+    if (!this) {goto error;}
+
+    this->nDim      = nDim;
+    this->kernels   = polygonTreeVector->kernels;
+    this->nPolygons = nPolygons;
+    this->vertices   = NULL;
+    this->neighbors  = NULL;
+    this->transforms = NULL;
+    this->nGridCells   = 0;
+    this->gridLower    = NULL;
+    this->gridScale    = NULL;
+    this->gridPolygons = NULL;
+    this->hullNeighbors = NULL;
+    this->hullOffsets   = NULL;
+    this->hullPolygons  = NULL;
+
+    this->vertices  = (size_t*) MALLOC(nPolygons * nVerticesInPolygon(nDim) * sizeof(size_t));
+    if (!(this->vertices))  {goto error;}
+    this->neighbors = (size_t*) MALLOC(nPolygons * nVerticesInPolygon(nDim) * sizeof(size_t));
+    if (!(this->neighbors)) {goto error;}
+
+    // Neighbors of current polygons are current
+    for (size_t i = 0 ; i < (polygonTreeVector->size) ; i++) {
+        if (compactIndex[i] == noPolygon) {continue;}
+
+        const size_t* const vertices  = PolygonTreeVector__vertices (polygonTreeVector, i);
+        const size_t* const neighbors = PolygonTreeVector__neighbors(polygonTreeVector, i);
+        for (size_t j = 0 ; j < nVerticesInPolygon(nDim) ; j++) {
+            Triangulation__vertices (this, compactIndex[i])[j] = vertices[j];
+            Triangulation__neighbors(this, compactIndex[i])[j] = (neighbors[j] != noPolygon)
+                ? compactIndex[neighbors[j]]
+                : noPolygon;
+        }
+    }
+
+    FREE(compactIndex);
+
+    return this;
+
+error:
+
+    if (compactIndex) {FREE(compactIndex);}
+    if (this)         {Triangulation__delete(this);}
+
+    return NULL;
+}
+
+void Triangulation__delete(
+    Triangulation* const this
+) {
+    if (this->vertices)  {FREE(this->vertices);}
+    if (this->neighbors)  {FREE(this->neighbors);}
+    if (this->transforms) {FREE(this->transforms);}
+    if (this->gridLower)    {FREE(this->gridLower);}
+    if (this->gridScale)    {FREE(this->gridScale);}
+    if (this->gridPolygons) {FREE(this->gridPolygons);}
+    if (this->hullNeighbors) {FREE(this->hullNeighbors);}
+    if (this->hullOffsets)   {FREE(this->hullOffsets);}
+    if (this->hullPolygons)  {FREE(this->hullPolygons);}
+    FREE(this);
+}
+
+int Triangulation__precompute_transforms(
+    Triangulation* const this,
+    const Points points,
+    Points__get_coordinates* const get_coordinates
+) {
+    const size_t nDim = this->nDim;
+
+    int status = SUCCESS;
+
+    const double** shape      = NULL;
+    double*        transforms = NULL;
+
+    shape = (const double**) MALLOC(nVerticesInPolygon(nDim) * sizeof(double*));
+    if (!shape) {status = FAILURE; goto finally;}
+
+    transforms = (double*) MALLOC(this->nPolygons * nDim * nDim * sizeof(double));
+    if (!transforms) {status = FAILURE; goto finally;}
+
+    for (size_t iPolygon = 0 ; iPolygon < (this->nPolygons) ; iPolygon++) {
+        for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
+            shape[i] = get_coordinates(points, Triangulation__vertices(this, iPolygon)[i]);
+        }
+
+        status = barycentricTransformOfPolygon(
+            nDim, shape, &transforms[iPolygon * nDim * nDim]
+        );
+        if (status) {goto finally;}
+    }
+
+    if (this->transforms) {FREE(this->transforms);}
+    this->transforms = transforms;
+    transforms = NULL;
+
+finally:
+
+    if (shape)      {FREE(shape);}
+    if (transforms) {FREE(transforms);}
+
+    return status;
+}
+
+int Triangulation__calculate_divisionRatio(
+    const Triangulation* const this,
+    const size_t iPolygon,
+    const double* const coordinates,
+    const Points points,
+    Points__get_coordinates* const get_coordinates,
+    QueryWorkspace* const workspace
+) {
+    const size_t nDim = this->nDim;
+
+    if (this->transforms) {
+        divisionRatio__from_transform(
+            nDim,
+            &(this->transforms)[iPolygon * nDim * nDim],
+            get_coordinates(points, Triangulation__vertices(this, iPolygon)[0]),
+            coordinates,
+            workspace->divisionRatio
+        );
+        return SUCCESS;
+    }
+
+    const double** const shape = workspace->shape;
+    for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
+        shape[i] = get_coordinates(points, Triangulation__vertices(this, iPolygon)[i]);
+    }
+
+    // The generic kernel allocates its LAPACK work areas, those of `workspace` are used instead
+    if (this->kernels.divisionRatio == divisionRatioFromPolygonVertices) {
+        return divisionRatioFromPolygonVertices__workspace(
+            nDim,
+            shape,
+            coordinates,
+            workspace->divisionRatio,
+            workspace->matrix,
+            workspace->ipiv
+        );
+    }
+
+    return this->kernels.divisionRatio(
+        nDim,
+        shape,
+        coordinates,
+        workspace->divisionRatio
+    );
+}
+
+int Triangulation__find_hullNeighbors(
+    Triangulation* const this,
+    const size_t nPoints
+) {
+    const size_t nDim = this->nDim;
+
+    size_t* const hullNeighbors = (size_t*) MALLOC(this->nPolygons * sizeof(size_t));
+    if (!hullNeighbors) {return FAILURE;}
+
+    // Vertices are sorted, those out of `points[0..nPoints)` are the last ones
+    for (size_t iPolygon = 0 ; iPolygon < (this->nPolygons) ; iPolygon++) {
+        const size_t* const vertices = Triangulation__vertices(this, iPolygon);
+
+        hullNeighbors[iPolygon] = noPolygon;
+
+        const bool oneVertexOut = (vertices[nDim] >= nPoints) && (vertices[nDim-1] < nPoints);
+        if (!oneVertexOut) {continue;}
+
+        const size_t neighbor = Triangulation__neighbors(this, iPolygon)[nDim];
+        if (neighbor == noPolygon) {continue;}
+
+        if (Triangulation__vertices(this, neighbor)[nDim] < nPoints) {
+            hullNeighbors[iPolygon] = neighbor;
+        }
+    }
+
+    if (this->hullNeighbors) {FREE(this->hullNeighbors);}
+    this->hullNeighbors = hullNeighbors;
+
+    return SUCCESS;
+}
+
+int Triangulation__build_hullIndex(
+    Triangulation* const this,
+    const size_t nPoints
+) {
+    const size_t nDim = this->nDim;
+
+    int status = SUCCESS;
+
+    size_t*      offsets         = NULL;
+    size_t*      polygons        = NULL;
+    IndexVector* hullPolygons    = NULL;
+    IndexVector* overlapVertices = NULL;
+    IndexVector* aroundPolygons  = NULL;
+
+    if (!(this->hullNeighbors)) {
+        status = FAILURE; goto finally;
+    }
+
+    offsets         = (size_t*) MALLOC(((this->nPolygons) + 1) * sizeof(size_t));
+    hullPolygons    = IndexVector__new(0);
+    overlapVertices = IndexVector__new(0);
+    aroundPolygons  = IndexVector__new(0);
+    if (!offsets || !hullPolygons || !overlapVertices || !aroundPolygons) {
+        status = FAILURE; goto finally;
+    }
+
+    for (size_t iPolygon = 0 ; iPolygon < (this->nPolygons) ; iPolygon++) {
+        const size_t* const vertices = Triangulation__vertices(this, iPolygon);
+
+        offsets[iPolygon] = hullPolygons->size;
+
+        // Vertices are sorted, those out of `points[0..nPoints)` are the last ones
+        if (vertices[nDim] < nPoints) {continue;}
+
+        // [1] one vertex out -> the polygon across the hull facet
+        if ((this->hullNeighbors)[iPolygon] != noPolygon) {
+            status = IndexVector__append(hullPolygons, (this->hullNeighbors)[iPolygon]);
+            if (status) {goto finally;}
+            continue;
+        }
+
+        // [2] otherwise -> polygons across hull facets around the vertices on table
+        IndexVector__clear(overlapVertices);
+        IndexVector__clear(aroundPolygons);
+
+        for (size_t i = 0 ; i < nVerticesInPolygon(nDim) && vertices[i] < nPoints ; i++) {
+            status = IndexVector__append(overlapVertices, vertices[i]);
+            if (status) {goto finally;}
+        }
+        if (overlapVertices->size == 0) {continue;}
+
+        status = Triangulation__get_around(this, iPolygon, overlapVertices, aroundPolygons);
+        if (status) {goto finally;}
+
+        for (size_t iAround = 0 ; iAround < (aroundPolygons->size) ; iAround++) {
+            const size_t hullNeighbor = (this->hullNeighbors)[IndexVector__elements(aroundPolygons)[iAround]];
+            if (hullNeighbor == noPolygon) {continue;}
+
+            bool found = false;
+            for (size_t i = offsets[iPolygon] ; i < (hullPolygons->size) ; i++) {
+                if (IndexVector__elements(hullPolygons)[i] == hullNeighbor) {
+                    found = true; break;
+                }
+            }
+            if (found) {continue;}
+
+            status = IndexVector__append(hullPolygons, hullNeighbor);
+            if (status) {goto finally;}
+        }
+    }
+    offsets[this->nPolygons] = hullPolygons->size;
+
+    polygons = (size_t*) MALLOC(
+        ((hullPolygons->size > 0) ? hullPolygons->size : 1) * sizeof(size_t)
+    );
+    if (!polygons) {
+        status = FAILURE; goto finally;
+    }
+    for (size_t i = 0 ; i < (hullPolygons->size) ; i++) {
+        polygons[i] = IndexVector__elements(hullPolygons)[i];
+    }
+
+    if (this->hullOffsets)  {FREE(this->hullOffsets);}
+    if (this->hullPolygons) {FREE(this->hullPolygons);}
+
+    this->hullOffsets  = offsets;  offsets  = NULL;
+    this->hullPolygons = polygons; polygons = NULL;
+
+finally:
+
+    if (offsets)         {FREE(offsets);}
+    if (polygons)        {FREE(polygons);}
+    if (hullPolygons)    {IndexVector__delete(hullPolygons);}
+    if (overlapVertices) {IndexVector__delete(overlapVertices);}
+    if (aroundPolygons)  {IndexVector__delete(aroundPolygons);}
+
+    return status;
+}
+
+int Triangulation__extrapolate(
+    const Triangulation* const this,
+    const size_t iPolygon,
+    const double* const coordinates,
+    const Points points,
+    Points__get_coordinates* const get_coordinates,
+    size_t* const foundPolygon,
+    QueryWorkspace* const workspace
+) {
+    const size_t nDim = this->nDim;
+    const double* const divisionRatio = workspace->divisionRatio;
+
+    int status = SUCCESS;
+
+    *foundPolygon = noPolygon;
+
+    if (!(this->hullOffsets) || !(iPolygon < (this->nPolygons))) {
+        return FAILURE;
+    }
+
+    const size_t begin = (this->hullOffsets)[iPolygon];
+    const size_t end   = (this->hullOffsets)[iPolygon + 1];
+
+    size_t bestPolygon  = noPolygon;
+    double bestMinRatio = -HUGE_VAL;
+
+    for (size_t i = begin ; i < end ; i++) {
+        const size_t candidate = (this->hullPolygons)[i];
+
+        status = Triangulation__calculate_divisionRatio(
+            this, candidate, coordinates, points, get_coordinates, workspace
+        );
+        if (status) {return status;}
+
+        double minRatio = HUGE_VAL;
+        for (size_t j = 0 ; j < nVerticesInPolygon(nDim) ; j++) {
+            if (divisionRatio[j] < minRatio) {minRatio = divisionRatio[j];}
+        }
+
+        if (minRatio > bestMinRatio) {
+            bestPolygon  = candidate;
+            bestMinRatio = minRatio;
+        }
+    }
+
+    if (bestPolygon == noPolygon) {
+        return FAILURE;
+    }
+
+    // Division ratio of the last candidate is left in `workspace`
+    if (bestPolygon != (this->hullPolygons)[end - 1]) {
+        status = Triangulation__calculate_divisionRatio(
+            this, bestPolygon, coordinates, points, get_coordinates, workspace
+        );
+        if (status) {return status;}
+    }
+
+    *foundPolygon = bestPolygon;
+    return SUCCESS;
+}
+
+/// Nearest of sampled polygons
+static size_t Triangulation__sample(
+    const Triangulation* const this,
+    const double* const coordinates,
+    const Points points,
+    Points__get_coordinates* const get_coordinates
+) {
+    const size_t nDim = this->nDim;
+
+    const double nSamples__double = pow(
+        (double) (this->nPolygons),
+        1.0 / (double) nVerticesInPolygon(nDim)
+    );
+    const size_t nSamples = (nSamples__double > 1.0) ? (size_t) nSamples__double : 1;
+
+    size_t nearestPolygon  = this->nPolygons - 1;
+    double nearestDistance = HUGE_VAL;
+
+    for (size_t iSample = 0 ; iSample < nSamples ; iSample++) {
+        const size_t iPolygon = (this->nPolygons - 1) - iSample * ((this->nPolygons) / nSamples);
+        const double* const vertex = get_coordinates(
+            points,
+            Triangulation__vertices(this, iPolygon)[0]
+        );
+
+        double distance = 0.0;
+        for (size_t i = 0 ; i < nDim ; i++) {
+            distance += (vertex[i] - coordinates[i]) * (vertex[i] - coordinates[i]);
+        }
+
+        if (distance < nearestDistance) {
+            nearestPolygon  = iPolygon;
+            nearestDistance = distance;
+        }
+    }
+
+    return nearestPolygon;
+}
+
+int Triangulation__build_grid(
+    Triangulation* const this,
+    const Points points,
+    Points__get_coordinates* const get_coordinates,
+    const size_t nPoints
+) {
+    const size_t nDim = this->nDim;
+
+    int status = SUCCESS;
+
+    double*         lower     = NULL;
+    double*         scale     = NULL;
+    size_t*         polygons  = NULL;
+    size_t*         cell      = NULL;
+    double*         center    = NULL;
+    QueryWorkspace* workspace = NULL;
+
+    // About one cell per polygon, same number of cells for each axis
+    const double nCells__double = floor(pow((double) (this->nPolygons), 1.0 / (double) nDim));
+    const size_t nCells = (nCells__double > 1.0) ? (size_t) nCells__double : 1;
+
+    size_t nAllCells = 1;
+    for (size_t i = 0 ; i < nDim ; i++) {
+        nAllCells *= nCells;
+    }
+
+    lower     = (double*) MALLOC(nDim * sizeof(double));
+    scale     = (double*) MALLOC(nDim * sizeof(double));
+    polygons  = (size_t*) MALLOC(nAllCells * sizeof(size_t));
+    cell      = (size_t*) MALLOC(nDim * sizeof(size_t));
+    center    = (double*) MALLOC(nDim * sizeof(double));
+    workspace = QueryWorkspace__new(nDim);
+    if (!lower || !scale || !polygons || !cell || !center || !workspace) {
+        status = FAILURE; goto finally;
+    }
+
+    // Bounding box of points
+    for (size_t i = 0 ; i < nDim ; i++) {
+        lower[i] = +HUGE_VAL;
+        scale[i] = -HUGE_VAL;  // upper corner until scaled
+    }
+    for (size_t iPoint = 0 ; iPoint < nPoints ; iPoint++) {
+        const double* const coordinates = get_coordinates(points, iPoint);
+        for (size_t i = 0 ; i < nDim ; i++) {
+            if (coordinates[i] < lower[i]) {lower[i] = coordinates[i];}
+            if (coordinates[i] > scale[i]) {scale[i] = coordinates[i];}
+        }
+    }
+    for (size_t i = 0 ; i < nDim ; i++) {
+        scale[i] = (scale[i] > lower[i]) ? (double) nCells / (scale[i] - lower[i]) : 0.0;
+    }
+
+    // Cells in row major order, each walk starts from the polygon of the previous cell
+    for (size_t i = 0 ; i < nDim ; i++) {
+        cell[i] = 0;
+    }
+
+    size_t previousPolygon = noPolygon;
+
+    for (size_t iCell = 0 ; iCell < nAllCells ; iCell++) {
+        for (size_t i = 0 ; i < nDim ; i++) {
+            center[i] = (scale[i] > 0.0)
+                ? lower[i] + ((double) cell[i] + 0.5) / scale[i]
+                : lower[i];
+        }
+
+        const size_t startPolygon = (previousPolygon != noPolygon)
+            ? previousPolygon
+            : Triangulation__sample(this, center, points, get_coordinates);
+
+        size_t polygon = noPolygon;
+        status = Triangulation__walk(
+            this,
+            startPolygon,
+            center,
+            points,
+            get_coordinates,
+            this->nPolygons,  // maxSteps
+            &polygon,
+            workspace
+        );
+        if (status) {polygon = noPolygon;}  // cells without polygon fall back to sampling
+
+        polygons[iCell] = polygon;
+        previousPolygon = polygon;
+
+        // next cell
+        for (size_t i = nDim ; i-- > 0 ;) {
+            if (++cell[i] < nCells) {break;}
+            cell[i] = 0;
+        }
+    }
+
+    status = SUCCESS;
+
+    if (this->gridLower)    {FREE(this->gridLower);}
+    if (this->gridScale)    {FREE(this->gridScale);}
+    if (this->gridPolygons) {FREE(this->gridPolygons);}
+
+    this->nGridCells   = nCells;
+    this->gridLower    = lower;    lower    = NULL;
+    this->gridScale    = scale;    scale    = NULL;
+    this->gridPolygons = polygons; polygons = NULL;
+
+finally:
+
+    if (lower)     {FREE(lower);}
+    if (scale)     {FREE(scale);}
+    if (polygons)  {FREE(polygons);}
+    if (cell)      {FREE(cell);}
+    if (center)    {FREE(center);}
+    if (workspace) {QueryWorkspace__delete(workspace);}
+
+    return status;
+}
+
+size_t Triangulation__jump(
+    const Triangulation* const this,
+    const double* const coordinates,
+    const Points points,
+    Points__get_coordinates* const get_coordinates
+) {
+    const size_t nDim = this->nDim;
+
+    if (this->nGridCells > 0) {
+        size_t iCell = 0;
+        for (size_t i = 0 ; i < nDim ; i++) {
+            const double position = (coordinates[i] - (this->gridLower)[i]) * (this->gridScale)[i];
+
+            size_t index = 0;
+            if (position >= (double) (this->nGridCells)) {
+                index = (this->nGridCells) - 1;
+            } else if (position > 0.0) {
+                index = (size_t) position;
+            }
+
+            iCell = iCell * (this->nGridCells) + index;
+        }
+
+        const size_t polygon = (this->gridPolygons)[iCell];
+        if (polygon != noPolygon) {return polygon;}
+    }
+
+    return Triangulation__sample(this, coordinates, points, get_coordinates);
+}
+
+int Triangulation__walk(
+    const Triangulation* const this,
+    const size_t startPolygon,
+    const double* const coordinates,
+    const Points points,
+    Points__get_coordinates* const get_coordinates,
+    const size_t maxSteps,
+    size_t* const foundPolygon,
+    QueryWorkspace* const workspace
+) {
+    const size_t nDim = this->nDim;
+    const double* const divisionRatio = workspace->divisionRatio;
+
+    int status = SUCCESS;
+
+    *foundPolygon = noPolygon;
+
+    /**
+     * Stochastic visibility walk (same as `PolygonTreeVector__walk`)
+     */
+    uint64_t randomState = 0;
+    size_t iPolygon = startPolygon;
+
+    for (size_t step = 0 ; step <= maxSteps ; step++) {
+        status = Triangulation__calculate_divisionRatio(
+            this,
+            iPolygon,
+            coordinates,
+            points,
+            get_coordinates,
+            workspace
+        );
+        if (status) {return status;}
+
+        randomState = randomState * 6364136223846793005ULL + 1442695040888963407ULL;
+        const size_t offset = (size_t) (randomState >> 33) % nVerticesInPolygon(nDim);
+
+        size_t iEx = nVerticesInPolygon(nDim);
+        for (size_t j = 0 ; j < nVerticesInPolygon(nDim) ; j++) {
+            const size_t i = (j + offset) % nVerticesInPolygon(nDim);
+            if (double__compare(divisionRatio[i], 0.0) < 0) {
+                iEx = i; break;
+            }
+        }
+
+        // if coordinates in polygon: SUCCESS, result is polygon
+        if (iEx == nVerticesInPolygon(nDim)) {
+            *foundPolygon = iPolygon;
+            return SUCCESS;
+        }
+
+        const size_t next = Triangulation__neighbors(this, iPolygon)[iEx];
+
+        // if coordinates outside all polygons: SUCCESS, result is noPolygon
+        if (next == noPolygon) {
+            return SUCCESS;
+        }
+
+        iPolygon = next;
+    }
+
+    // walk does not terminate: failure
+    return FAILURE;
+}
+
+int Triangulation__get_around(
+    const Triangulation* const this,
+    const size_t iPolygon,
+    const IndexVector* const overlapVertices,
+    IndexVector* const aroundPolygons
+) {
+    const size_t nDim = this->nDim;
+
+    int status = SUCCESS;
+
+    const size_t firstAround = aroundPolygons->size;
+
+    status = IndexVector__append(aroundPolygons, iPolygon);
+    if (status) {return status;}
+
+    // Breadth first search through faces which contain all `overlapVertices`
+    for (size_t iAround = firstAround ; iAround < (aroundPolygons->size) ; iAround++) {
+        const size_t polygon = IndexVector__elements(aroundPolygons)[iAround];
+        const size_t* const vertices = Triangulation__vertices(this, polygon);
+
+        for (size_t iEx = 0 ; iEx < nVerticesInPolygon(nDim) ; iEx++) {
+            if (contains__size_t__Array(
+                overlapVertices->size, IndexVector__elements(overlapVertices),
+                1                    , &vertices[iEx]
+            )) {continue;}
+
+            const size_t candidate = Triangulation__neighbors(this, polygon)[iEx];
+            if (candidate == noPolygon) {continue;}
+
+            bool found = false;
+            for (size_t i = firstAround ; i < (aroundPolygons->size) ; i++) {
+                if (IndexVector__elements(aroundPolygons)[i] == candidate) {
+                    found = true; break;
+                }
+            }
+            if (found) {continue;}
+
+            status = IndexVector__append(aroundPolygons, candidate);
+            if (status) {return status;}
+        }
+    }
+
+    return status;
+}
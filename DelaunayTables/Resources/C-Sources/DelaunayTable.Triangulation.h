@@ -0,0 +1,229 @@
+#pragma once
+
+#include "DelaunayTable.PolygonTree.h"
+#include "DelaunayTable.IndexVector.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+
+/// # Query
+enum Query {
+    Query__solve = 1,   /// solve division ratios of each visited polygon
+    Query__precomputed  /// precompute barycentric transforms of all polygons after construction
+};
+
+/// # QueryIndex
+enum QueryIndex {
+    QueryIndex__jump = 1,  /// start walks from the nearest of sampled polygons
+    QueryIndex__grid       /// start walks from the polygon of the grid cell, see `Triangulation__build_grid`
+};
+
+/// # Extrapolation
+enum Extrapolation {
+    Extrapolation__none = 1,  /// inputs out of the convex hull of the table fail
+    Extrapolation__linear     /// linear extension of a boundary polygon, see `Triangulation__build_hullIndex`
+};
+
+
+/** # Triangulation
+ * Current polygons of a delaunay divided table and their neighbors.
+ * It is compacted from `PolygonTreeVector` after construction,
+ * dead polygons and the history are not kept.
+ */
+typedef struct {
+    size_t nDim;
+    GeometryKernels kernels;  /// geometry kernels selected for `nDim`
+    size_t nPolygons;
+    size_t* vertices;   /// size_t[nPolygons][nDim+1], sorted in each polygon
+    size_t* neighbors;  /// size_t[nPolygons][nDim+1], polygon across the face opposite to each vertex
+    double* transforms; /// double[nPolygons][nDim][nDim] or NULL, see `Triangulation__precompute_transforms`
+    size_t  nGridCells;    /// cells of the grid per axis, 0 if not built
+    double* gridLower;     /// double[nDim], lower corner of the grid
+    double* gridScale;     /// double[nDim], cells per unit length
+    size_t* gridPolygons;  /// size_t[nGridCells^nDim], polygon containing the center of each cell
+    size_t* hullNeighbors; /// size_t[nPolygons] or NULL, see `Triangulation__find_hullNeighbors`
+    size_t* hullOffsets;   /// size_t[nPolygons+1] or NULL, see `Triangulation__build_hullIndex`
+    size_t* hullPolygons;  /// size_t[hullOffsets[nPolygons]], boundary polygons of each polygon
+} Triangulation;
+
+
+/** # QueryWorkspace
+ * Work areas of queries on a triangulation of `nDim`,
+ * created once per caller (thread) and reused, queries do not allocate memory.
+ * Vectors for inputs on faces are created at first use and keep their capacities.
+ */
+typedef struct {
+    size_t nDim;
+    double*        divisionRatio;    /// double[nDim+1]
+    const double** shape;            /// const double*[nDim+1]
+    const double** values;           /// const double*[nDim+1], outputs at vertices for jacobians
+    double*        matrix;           /// double[nDim][nDim], for the generic (LAPACK) kernels
+    int*           ipiv;             /// int[nDim]     , for the generic (LAPACK) kernels
+    IndexVector*   overlapVertices;  /// NULL until first use
+    IndexVector*   aroundPolygons;   /// NULL until first use
+} QueryWorkspace;
+
+/// ## QueryWorkspace methods
+extern QueryWorkspace* QueryWorkspace__new(
+    const size_t nDim
+);
+
+extern void QueryWorkspace__delete(
+    QueryWorkspace* this
+);
+
+/// Bytes of the block of a workspace of `nDim`, the header followed by its arrays
+extern size_t QueryWorkspace__size(
+    const size_t nDim
+);
+
+/**
+ * Workspace in `buffer` of the caller (`QueryWorkspace__size(nDim)` bytes, aligned for any type),
+ * e.g. on the stack. It is released by `QueryWorkspace__release`, not `QueryWorkspace__delete`.
+ */
+extern QueryWorkspace* QueryWorkspace__on_buffer(
+    const size_t nDim,
+    void* buffer
+);
+
+/// Delete vectors created at first use, the block of the workspace is kept
+extern void QueryWorkspace__release(
+    QueryWorkspace* this
+);
+
+
+/// ## Triangulation methods
+extern Triangulation* Triangulation__from_polygonTreeVector(
+    const PolygonTreeVector* polygonTreeVector
+);
+
+extern void Triangulation__delete(
+    Triangulation* this
+);
+
+static inline size_t* Triangulation__vertices(
+    const Triangulation* const this,
+    const size_t iPolygon
+) {
+    return this->vertices + iPolygon * nVerticesInPolygon(this->nDim);
+}
+
+static inline size_t* Triangulation__neighbors(
+    const Triangulation* const this,
+    const size_t iPolygon
+) {
+    return this->neighbors + iPolygon * nVerticesInPolygon(this->nDim);
+}
+
+/**
+ * Precompute barycentric transforms of all polygons,
+ * then division ratios are calculated by a matrix-vector product
+ * (nDim*nDim doubles per polygon).
+ */
+extern int Triangulation__precompute_transforms(
+    Triangulation* this,
+    const Points points,
+    Points__get_coordinates* get_coordinates
+);
+
+/// Division ratio of `coordinates` by `iPolygon` into `workspace->divisionRatio`
+extern int Triangulation__calculate_divisionRatio(
+    const Triangulation* this,
+    const size_t iPolygon,
+    const double* coordinates,
+    const Points points,
+    Points__get_coordinates* get_coordinates,
+    QueryWorkspace* workspace
+);
+
+/**
+ * For each polygon with one vertex out of `points[0..nPoints)` (a vertex of the big polygon),
+ * the polygon across the face opposite to it if all of its vertices are in `points[0..nPoints)`,
+ * otherwise `noPolygon`. The face is a facet of the convex hull of `points[0..nPoints)`,
+ * inputs on it are redirected to the polygon across without search.
+ */
+extern int Triangulation__find_hullNeighbors(
+    Triangulation* this,
+    const size_t nPoints
+);
+
+/**
+ * Boundary polygons (on table, across a facet of the convex hull) to extrapolate from,
+ * for each polygon with vertices out of `points[0..nPoints)`.
+ * Those of a polygon are the boundary polygons across the hull facets
+ * around the vertices of the polygon in `points[0..nPoints)`.
+ * Requires `Triangulation__find_hullNeighbors`.
+ */
+extern int Triangulation__build_hullIndex(
+    Triangulation* this,
+    const size_t nPoints
+);
+
+/**
+ * Boundary polygon of `iPolygon` to extrapolate `coordinates` from,
+ * the one with the greatest minimum division ratio (the least extrapolated).
+ * `workspace->divisionRatio` is that of `foundPolygon`, some of them are negative.
+ * Fails if `iPolygon` has no boundary polygon, then `foundPolygon` is `noPolygon`.
+ */
+extern int Triangulation__extrapolate(
+    const Triangulation* this,
+    const size_t iPolygon,
+    const double* coordinates,
+    const Points points,
+    Points__get_coordinates* get_coordinates,
+    size_t* foundPolygon,
+    QueryWorkspace* workspace
+);
+
+/**
+ * Uniform grid over the bounding box of `points[0..nPoints)`, about one cell per polygon.
+ * Each cell keeps the polygon containing its center,
+ * `Triangulation__jump` becomes a lookup of the cell independent of the insertion history.
+ */
+extern int Triangulation__build_grid(
+    Triangulation* this,
+    const Points points,
+    Points__get_coordinates* get_coordinates,
+    const size_t nPoints
+);
+
+/**
+ * Choose a polygon near `coordinates` to start `Triangulation__walk`.
+ * The polygon of the grid cell containing `coordinates` (clamped to the grid) if the grid is built,
+ * otherwise the nearest of sampled polygons (jump & walk).
+ */
+extern size_t Triangulation__jump(
+    const Triangulation* this,
+    const double* coordinates,
+    const Points points,
+    Points__get_coordinates* get_coordinates
+);
+
+/**
+ * Find polygon contains `coordinates` by walking through neighbors from `startPolygon`.
+ * If `coordinates` is outside of all polygons, `foundPolygon` is `noPolygon`.
+ * `workspace->divisionRatio` is that of the last visited polygon.
+ * Fails if the walk does not terminate in `maxSteps`.
+ */
+extern int Triangulation__walk(
+    const Triangulation* this,
+    const size_t startPolygon,
+    const double* coordinates,
+    const Points points,
+    Points__get_coordinates* get_coordinates,
+    const size_t maxSteps,
+    size_t* foundPolygon,
+    QueryWorkspace* workspace
+);
+
+/**
+ * Append polygons around `iPolygon` to `aroundPolygons`.
+ * Polygons sharing all of `overlapVertices` are connected through their faces.
+ */
+extern int Triangulation__get_around(
+    const Triangulation* this,
+    const size_t iPolygon,
+    const IndexVector* overlapVertices,
+    IndexVector* aroundPolygons
+);
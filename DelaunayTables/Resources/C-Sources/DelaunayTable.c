@@ -4,6 +4,50 @@
 #include "DelaunayTable.Error.h"
 
 #include <stdbool.h>
+#include <stdint.h>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+
+/// Number of points located by each thread before the serial insertion
+static const size_t nPointsToLocatePerThread = 64;
+
+/// Bytes of the workspace of `DelaunayTable__get_value_from_hint` on the stack, enough for `nIn` up to 9
+#define DelaunayTable__stackWorkspaceBytes (1024)
+
+/// Chunks of inputs per thread of `DelaunayTable__get_values_parallel`, for load balancing
+static const size_t nChunksPerQueryThread = 16;
+
+/// Minimum inputs in a chunk, walks from the previous input pay off in long chunks
+static const size_t minValuesInChunk = 256;
+
+/**
+ * Distance of the big polygon relative to `2 nDim maxAbs` of the table.
+ * Spheres through a flat face of the convex hull bulge far outward,
+ * the big polygon must be outside of them so that the face appears in the triangulation
+ * and points on it are covered by polygons on table (exact predicates keep the construction robust).
+ *
+ * A hull face of circumradius r is in the triangulation if a sphere through it excludes
+ * the table points inside and the big vertices outside. The sphere centered t beyond the face
+ * dips r^2 / 2t inside and reaches 2t outside, with the big vertices at L from the face
+ * (L ~ scale * 2 nDim maxAbs and r <= sqrt(nDim) maxAbs), such a sphere exists
+ * unless a table point is within about r^2 / L = r / scale of the face plane.
+ * So faces flat up to 1e-4 of the table size are kept (with a scale of 1, about 3% of
+ * queries on facets of a dense 3D or 4D cube fell outside of polygons on table).
+ * - Safe: the construction uses exact predicates,
+ *   and coordinates up to 1e4 * 2 nDim maxAbs are far from overflow in their products.
+ * - Conditioning: polygons with big vertices are stretched by the scale, their division ratios
+ *   lose about log10(scale) = 4 digits. They only tell that inputs are outside of the hull,
+ *   values are never interpolated from big vertices.
+ * - Far queries: inputs beyond the big polygon (about scale * 2 nDim maxAbs away)
+ *   are outside of all polygons and fail, even with `Extrapolation__linear`.
+ */
+static const double bigPolygonScale = 1.0e4;
+
+/// Alignment of packed outputs [bytes], a cache line (and an AVX-512 vector)
+static const size_t outputAlignment = 64;
 
 
 /// ## static function declarations
@@ -12,10 +56,113 @@ static const double* DelaunayTable__get_coordinates(
     const size_t iPoint
 );
 
+/// Outputs of table point `iPoint`, double[nOut]
+static const double* DelaunayTable__get_outputs(
+    const DelaunayTable* this,
+    const size_t iPoint
+);
+
+/// Inputs of `DelaunayTable__get_values` as `Points`
+typedef struct {
+    size_t nIn;
+    const double* u;
+} DelaunayTable__Inputs;
+
+static const double* DelaunayTable__Inputs__get_coordinates(
+    const DelaunayTable__Inputs* this,
+    const size_t iValue
+);
+
+/**
+ * Locate `u` walking from `startPolygon`, `polygon` is the polygon found (on table),
+ * `workspace->divisionRatio` is that of `polygon`.
+ */
+static int DelaunayTable__locate(
+    const DelaunayTable* this,
+    const size_t startPolygon,
+    const double* u,
+          size_t* polygon,
+          QueryWorkspace* workspace
+);
+
+/// `DelaunayTable__locate` from `hint`, or from `Triangulation__jump` if it fails
+static int DelaunayTable__locate_from_hint(
+    const DelaunayTable* this,
+    const double* u,
+          size_t* hint,
+          QueryWorkspace* workspace
+);
+
+/// Interpolate rows `outputs[iPoint * outputStride ...]` at vertices of `polygon` by `workspace->divisionRatio`
+static void DelaunayTable__interpolate_rows(
+    const DelaunayTable* this,
+    const size_t polygon,
+    const size_t nOut,
+    const size_t outputStride,
+    const double* outputs,
+          double* y,
+          QueryWorkspace* workspace
+);
+
+/// Interpolate `y` at `u` walking from `startPolygon`, `polygon` is the polygon found
+static int DelaunayTable__interpolate(
+    const DelaunayTable* this,
+    const size_t startPolygon,
+    const double* u,
+          double* y,
+          size_t* polygon,
+          QueryWorkspace* workspace
+);
+
+/**
+ * Interpolate inputs `order[0..nValues)` in succession by `DelaunayTable__interpolate`,
+ * fails if any of them fails.
+ */
+static int DelaunayTable__interpolate_in_order(
+    const DelaunayTable* this,
+    const size_t* order,
+    const size_t nValues,
+    const double* u,
+          double* y,
+          int*    statuses,  // nullable
+          QueryWorkspace* workspace
+);
+
 static void DelaunayTable__extend_table(
     DelaunayTable* this
 );
 
+/**
+ * Repack `nOut` outputs at `source[iPoint * sourceStride ...]` of table points into aligned rows,
+ * rows are padded to a multiple of `outputAlignment` if `nOut` is as wide.
+ * `block` is the allocation of `outputs`.
+ */
+static int DelaunayTable__pack_rows(
+    const DelaunayTable* this,
+    const size_t nOut,
+    const double* source,
+    const size_t sourceStride,
+          size_t* outputStride,
+          double** outputs,
+          void** block
+);
+
+/// Repack outputs of the table into `outputs` by `DelaunayTable__pack_rows`
+static void DelaunayTable__pack_outputs(
+    DelaunayTable* this,
+    ResourceStack resources
+);
+
+static void DelaunayTable__locate_points(
+    const DelaunayTable* this,
+    const PolygonTreeVector* polygonTreeVector,
+    const size_t rootPolygon,
+    const size_t nPoints,
+    const size_t* pointsToLocate,
+    const size_t nThreads,
+    size_t* locatedPolygons
+);
+
 static void DelaunayTable__delaunay_divide(
     DelaunayTable* this,
     const enum Verbosity verbosity,
@@ -25,8 +172,8 @@ static void DelaunayTable__delaunay_divide(
 static int ensure_polygon_on_table(
     const DelaunayTable* this,
     const double* coordinates,
-    PolygonTree** polygon,
-    double* divisionRatio
+    size_t* polygon,
+    QueryWorkspace* workspace
 );
 
 
@@ -36,6 +183,7 @@ DelaunayTable* DelaunayTable__from_buffer(
     const size_t nIn,
     const size_t nOut,
     const double* const buffer,
+    const DelaunayTableOptions* const options,
     const enum Verbosity verbosity,
     ResourceStack resources
 ) {
@@ -51,11 +199,26 @@ DelaunayTable* DelaunayTable__from_buffer(
     this->nIn     = nIn;
     this->nOut    = nOut;
     this->table   = buffer;
+    this->options = (options) ? *options : DelaunayTableOptions__default();
+
+    // Only the descent of the history is concurrent, `nThreads` would be ignored by the walk
+    if ((this->options.nThreads > 1) && (this->options.locator != Locator__history)) {
+        raise_Error(resources, "options.nThreads > 1 requires options.locator == Locator__history");
+    }
+
+    // Only the 2-to-n flip is implemented, random points in 3 or more dimensions need 3-to-2 flips
+    if ((this->options.inserter == Inserter__flip) && (nIn >= 3)) {
+        raise_Error(resources, "options.inserter == Inserter__flip requires nIn <= 2");
+    }
 
     // Resources
-    this->table_extended    = NULL;
-    this->polygonTreeVector = NULL;
-    this->neighborPairMap   = NULL;
+    this->table_extended = NULL;
+    this->triangulation  = NULL;
+    this->outputStride   = nOut;
+    this->outputs        = NULL;
+    this->outputsBlock   = NULL;
+    this->nAttached      = 0;
+    this->attached       = NULL;
 
     this->table_extended = ResourceStack__ensure_delete_on_error(
         resources,
@@ -63,18 +226,6 @@ DelaunayTable* DelaunayTable__from_buffer(
         FREE
     );
 
-    this->polygonTreeVector = ResourceStack__ensure_delete_on_error(
-        resources,
-        PolygonTreeVector__new(0),
-        PolygonTreeVector__delete
-    );
-
-    this->neighborPairMap = ResourceStack__ensure_delete_on_error(
-        resources,
-        NeighborPairMap__new(),
-        NeighborPairMap__delete
-    );
-
     DelaunayTable__extend_table(
         this
     );
@@ -85,6 +236,13 @@ DelaunayTable* DelaunayTable__from_buffer(
         resources
     );
 
+    if ((this->options.outputLayout == OutputLayout__packed) && (nOut > 0)) {
+        DelaunayTable__pack_outputs(
+            this,
+            resources
+        );
+    }
+
     ResourceStack__exit(resources);
     return this;
 }
@@ -94,9 +252,12 @@ void DelaunayTable__delete(
     DelaunayTable* const this
 ) {
     FREE(this->table_extended);
-    PolygonTreeVector__delete_elements(this->polygonTreeVector);
-    PolygonTreeVector__delete         (this->polygonTreeVector);
-    NeighborPairMap__delete(this->neighborPairMap);
+    Triangulation__delete(this->triangulation);
+    if (this->outputsBlock) {FREE(this->outputsBlock);}
+    for (size_t i = 0 ; i < (this->nAttached) ; i++) {
+        if ((this->attached)[i].outputsBlock) {FREE((this->attached)[i].outputsBlock);}
+    }
+    if (this->attached) {FREE(this->attached);}
     FREE(this);
 }
 
@@ -106,6 +267,55 @@ int DelaunayTable__get_value(
     size_t nOut,
     const double* u,
           double* y
+) {
+    size_t hint = noPolygon;
+
+    return DelaunayTable__get_value_from_hint(
+        this, nIn, nOut, u, y, &hint
+    );
+}
+
+int DelaunayTable__get_value_from_hint(
+    DelaunayTable* const this,
+    size_t nIn,
+    size_t nOut,
+    const double* u,
+          double* y,
+          size_t* hint
+) {
+    // Small workspaces live on the stack, larger ones are allocated per call
+    max_align_t buffer[DelaunayTable__stackWorkspaceBytes / sizeof(max_align_t)];
+
+    const bool onStack = QueryWorkspace__size(this->nIn) <= sizeof(buffer);
+
+    QueryWorkspace* const workspace = onStack
+        ? QueryWorkspace__on_buffer(this->nIn, buffer)
+        : QueryWorkspace__new(this->nIn);
+    if (!workspace) {
+        return FAILURE;
+    }
+
+    const int status = DelaunayTable__get_value_in_workspace(
+        this, nIn, nOut, u, y, hint, workspace
+    );
+
+    if (onStack) {
+        QueryWorkspace__release(workspace);
+    } else {
+        QueryWorkspace__delete(workspace);
+    }
+
+    return status;
+}
+
+int DelaunayTable__get_value_in_workspace(
+    DelaunayTable* const this,
+    size_t nIn,
+    size_t nOut,
+    const double* u,
+          double* y,
+          size_t* hint,
+          QueryWorkspace* workspace
 ) {
     // Assertion for nIn, nOut
     if (nIn != (this->nIn)) {
@@ -114,64 +324,324 @@ int DelaunayTable__get_value(
     if (nOut != (this->nOut)) {
         return FAILURE;
     }
+    if ((workspace->nDim) != (this->nIn)) {
+        return FAILURE;
+    }
 
-    const size_t nDim = this->nIn;
+    int status = SUCCESS;
 
+    status = DelaunayTable__locate_from_hint(
+        this, u, hint, workspace
+    );
+    if (status) {
+        return status;
+    }
+
+    DelaunayTable__interpolate_rows(
+        this,
+        *hint,
+        nOut,
+        (this->outputs) ? (this->outputStride) : (this->nIn + this->nOut),
+        (this->outputs) ? (this->outputs)      : (this->table + this->nIn),
+        y,
+        workspace
+    );
+
+    return SUCCESS;
+}
+
+int DelaunayTable__get_value_and_jacobian(
+    DelaunayTable* const this,
+    size_t nIn,
+    size_t nOut,
+    const double* u,
+          double* y,
+          double* dy_du,
+          size_t* hint,
+          QueryWorkspace* workspace
+) {
     int status = SUCCESS;
 
-    double* divisionRatio = (double*) MALLOC(nVerticesInPolygon(nDim) * sizeof(double));
-    if (!divisionRatio) {
-        status = FAILURE; goto finally;
+    status = DelaunayTable__get_value_in_workspace(
+        this, nIn, nOut, u, y, hint, workspace
+    );
+    if (status) {
+        return status;
+    }
+
+    // `hint` is the polygon found
+    const size_t nDim = this->nIn;
+    const Triangulation* const triangulation = this->triangulation;
+    const size_t* const vertices = Triangulation__vertices(triangulation, *hint);
+
+    for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
+        workspace->shape [i] = DelaunayTable__get_coordinates(this, vertices[i]);
+        workspace->values[i] = DelaunayTable__get_outputs    (this, vertices[i]);
     }
 
-    PolygonTree* polygon;
+    if (triangulation->transforms) {
+        jacobian__from_transform(
+            nDim,
+            nOut,
+            &(triangulation->transforms)[(*hint) * nDim * nDim],
+            workspace->values,
+            dy_du
+        );
+        return SUCCESS;
+    }
 
-    status = PolygonTree__find(
+    return jacobianOnPolygon__workspace(
         nDim,
-        PolygonTreeVector__elements(this->polygonTreeVector)[0],
-        u,
+        nOut,
+        workspace->shape,
+        workspace->values,
+        dy_du,
+        workspace->matrix,
+        workspace->ipiv
+    );
+}
+
+int DelaunayTable__attach_outputs(
+    DelaunayTable* const this,
+    size_t nOut,
+    const double* outputs,
+    size_t* iAttached
+) {
+    // Attached outputs are interpolated alone, outputs of `this` would be left out
+    if ((this->nOut) > 0) {
+        return FAILURE;
+    }
+
+    int status = SUCCESS;
+
+    DelaunayTableOutputs attached = {nOut, nOut, outputs, NULL};
+
+    if (this->options.outputLayout == OutputLayout__packed) {
+        double* packed = NULL;
+        status = DelaunayTable__pack_rows(
+            this, nOut, outputs, nOut, &(attached.outputStride), &packed, &(attached.outputsBlock)
+        );
+        if (status) {return status;}
+        attached.outputs = packed;
+    }
+
+    DelaunayTableOutputs* const allAttached = (DelaunayTableOutputs*) REALLOC(
+        this->attached,
+        (this->nAttached + 1) * sizeof(DelaunayTableOutputs)
+    );
+    if (!allAttached) {
+        if (attached.outputsBlock) {FREE(attached.outputsBlock);}
+        return FAILURE;
+    }
+
+    allAttached[this->nAttached] = attached;
+    if (iAttached) {*iAttached = this->nAttached;}
+
+    this->attached  = allAttached;
+    this->nAttached = this->nAttached + 1;
+
+    return SUCCESS;
+}
+
+int DelaunayTable__get_attached_value(
+    DelaunayTable* const this,
+    size_t nIn,
+    size_t iAttached,
+    size_t nOut,
+    const double* u,
+          double* y,
+          size_t* hint,
+          QueryWorkspace* workspace
+) {
+    // Assertion for nIn, iAttached, nOut
+    if (nIn != (this->nIn)) {
+        return FAILURE;
+    }
+    if (!(iAttached < (this->nAttached))) {
+        return FAILURE;
+    }
+    if (nOut != (this->attached)[iAttached].nOut) {
+        return FAILURE;
+    }
+    if ((workspace->nDim) != (this->nIn)) {
+        return FAILURE;
+    }
+
+    int status = SUCCESS;
+
+    status = DelaunayTable__locate_from_hint(
+        this, u, hint, workspace
+    );
+    if (status) {
+        return status;
+    }
+
+    const DelaunayTableOutputs* const attached = &(this->attached)[iAttached];
+    DelaunayTable__interpolate_rows(
         this,
-        (Points__get_coordinates*) DelaunayTable__get_coordinates,
-        &polygon,
-        divisionRatio
+        *hint,
+        attached->nOut,
+        attached->outputStride,
+        attached->outputs,
+        y,
+        workspace
+    );
+
+    return SUCCESS;
+}
+
+int DelaunayTable__get_attached_values(
+    DelaunayTable* const this,
+    size_t nIn,
+    const double* u,
+          double* const* y,
+          size_t* hint,
+          QueryWorkspace* workspace
+) {
+    // Assertion for nIn
+    if (nIn != (this->nIn)) {
+        return FAILURE;
+    }
+    if ((workspace->nDim) != (this->nIn)) {
+        return FAILURE;
+    }
+
+    int status = SUCCESS;
+
+    status = DelaunayTable__locate_from_hint(
+        this, u, hint, workspace
     );
     if (status) {
-        goto finally;
+        return status;
+    }
+
+    // Division ratios of the polygon are shared by all outputs
+    for (size_t i = 0 ; i < (this->nAttached) ; i++) {
+        const DelaunayTableOutputs* const attached = &(this->attached)[i];
+        DelaunayTable__interpolate_rows(
+            this,
+            *hint,
+            attached->nOut,
+            attached->outputStride,
+            attached->outputs,
+            y[i],
+            workspace
+        );
     }
 
-    if (!polygon) {
+    return SUCCESS;
+}
+
+int DelaunayTable__get_values(
+    DelaunayTable* const this,
+    size_t nIn,
+    size_t nOut,
+    size_t nValues,
+    const double* u,
+          double* y,
+          int*    statuses
+) {
+    return DelaunayTable__get_values_parallel(
+        this, nIn, nOut, nValues, u, y, statuses, 1
+    );
+}
+
+int DelaunayTable__get_values_parallel(
+    DelaunayTable* const this,
+    size_t nIn,
+    size_t nOut,
+    size_t nValues,
+    const double* u,
+          double* y,
+          int*    statuses,
+    size_t nThreads
+) {
+    if (statuses) {
+        for (size_t iValue = 0 ; iValue < nValues ; iValue++) {
+            statuses[iValue] = FAILURE;
+        }
+    }
+
+    // Assertion for nIn, nOut
+    if (nIn != (this->nIn)) {
+        return FAILURE;
+    }
+    if (nOut != (this->nOut)) {
+        return FAILURE;
+    }
+
+    if (nValues == 0) {
+        return SUCCESS;
+    }
+    if (nThreads == 0) {
+        nThreads = 1;
+    }
+
+    const size_t nDim = this->nIn;
+
+    int status = SUCCESS;
+
+    size_t* order = NULL;  // size_t[nValues]
+
+    order = (size_t*) MALLOC(nValues * sizeof(size_t));
+    if (!order) {
         status = FAILURE; goto finally;
     }
 
-    status = ensure_polygon_on_table(
-        this,
-        u,
-        &polygon,
-        divisionRatio
+    // Inputs close to each other are evaluated in succession
+    DelaunayTable__Inputs inputs = {nIn, u};
+
+    status = InsertionOrder__arrange(
+        InsertionOrder__hilbert,
+        nDim,
+        0,
+        nValues,
+        (Points) &inputs,
+        (Points__get_coordinates*) DelaunayTable__Inputs__get_coordinates,
+        order
     );
     if (status) {
         goto finally;
     }
 
-    /// # interpolate y[:]
-    /// ## initialize y[:]
-    for (size_t iOut = 0 ; iOut < nOut ; iOut++) {
-        y[iOut] = 0.0;
+    // Chunks of consecutive inputs along the curve are handed to idle threads
+    size_t chunkSize = nValues;
+    if (nThreads > 1) {
+        chunkSize = nValues / (nThreads * nChunksPerQueryThread);
+        if (chunkSize < minValuesInChunk) {chunkSize = minValuesInChunk;}
     }
-    /// ## linear interpolation by `divisionRatio`
-    for (size_t iVertex = 0 ; iVertex < nVerticesInPolygon(nDim) ; iVertex++) {
-        const double* coords = DelaunayTable__get_coordinates(
-            this,
-            polygon->vertices[iVertex]
-        );
-        for (size_t iOut = 0 ; iOut < nOut ; iOut++) {
-            y[iOut] += divisionRatio[iVertex] * coords[this->nIn + iOut];
+    const long nChunks = (long) ((nValues + chunkSize - 1) / chunkSize);
+
+    long nFailedChunks = 0;
+
+    #pragma omp parallel num_threads(nThreads) reduction(+:nFailedChunks)
+    {
+        // If allocation failed, inputs of chunks of this thread fail
+        QueryWorkspace* const workspace = QueryWorkspace__new(nDim);
+
+        #pragma omp for schedule(dynamic)
+        for (long iChunk = 0 ; iChunk < nChunks ; iChunk++) {
+            const size_t begin = (size_t) iChunk * chunkSize;
+            const size_t end   = (begin + chunkSize < nValues) ? begin + chunkSize : nValues;
+
+            const int chunkStatus = (workspace)
+                ? DelaunayTable__interpolate_in_order(
+                    this, order + begin, end - begin, u, y, statuses, workspace
+                )
+                : FAILURE;
+            if (chunkStatus) {nFailedChunks++;}
         }
+
+        if (workspace) {QueryWorkspace__delete(workspace);}
+    }
+
+    if (nFailedChunks > 0) {
+        status = FAILURE;
     }
 
 finally:
 
-    if (divisionRatio) {FREE(divisionRatio);}
+    if (order) {FREE(order);}
 
     return status;
 }
@@ -191,6 +661,263 @@ static const double* DelaunayTable__get_coordinates(
     }
 }
 
+static const double* DelaunayTable__get_outputs(
+    const DelaunayTable* const this,
+    const size_t iPoint
+) {
+    if (this->outputs) {
+        return (this->outputs) + (this->outputStride) * (iPoint - tablePointBegin(this));
+    }
+    return DelaunayTable__get_coordinates(this, iPoint) + (this->nIn);
+}
+
+/// y[:] = sum of ratio[i] * rows[i][:], two rows per pass over `y`
+static inline void DelaunayTable__weighted_sum(
+    const size_t nRows,
+    const size_t nOut,
+    const double* const* const rows,
+    const double*        const ratio,
+          double* restrict const y
+) {
+    size_t iRow = 0;
+
+    if (nRows % 2) {
+        const double* restrict const row0 = rows[0];
+        const double r0 = ratio[0];
+        for (size_t iOut = 0 ; iOut < nOut ; iOut++) {
+            y[iOut] = r0 * row0[iOut];
+        }
+        iRow = 1;
+    } else {
+        for (size_t iOut = 0 ; iOut < nOut ; iOut++) {
+            y[iOut] = 0.0;
+        }
+    }
+
+    for ( ; iRow < nRows ; iRow += 2) {
+        const double* restrict const row0 = rows[iRow];
+        const double* restrict const row1 = rows[iRow+1];
+        const double r0 = ratio[iRow];
+        const double r1 = ratio[iRow+1];
+        for (size_t iOut = 0 ; iOut < nOut ; iOut++) {
+            y[iOut] += r0 * row0[iOut] + r1 * row1[iOut];
+        }
+    }
+}
+
+static const double* DelaunayTable__Inputs__get_coordinates(
+    const DelaunayTable__Inputs* const this,
+    const size_t iValue
+) {
+    return (this->u) + (this->nIn) * iValue;
+}
+
+static int DelaunayTable__locate(
+    const DelaunayTable* const this,
+    const size_t startPolygon,
+    const double* const u,
+          size_t* const polygon,
+          QueryWorkspace* const workspace
+) {
+    int status = SUCCESS;
+
+    const Triangulation* const triangulation = this->triangulation;
+
+    status = Triangulation__walk(
+        triangulation,
+        startPolygon,
+        u,
+        (Points) this,
+        (Points__get_coordinates*) DelaunayTable__get_coordinates,
+        triangulation->nPolygons,  // maxSteps
+        polygon,
+        workspace
+    );
+    if (status) {
+        return status;
+    }
+
+    if (*polygon == noPolygon) {
+        return FAILURE;
+    }
+
+    const size_t walkedPolygon = *polygon;
+
+    status = ensure_polygon_on_table(
+        this,
+        u,
+        polygon,
+        workspace
+    );
+    if (status && this->options.extrapolation == Extrapolation__linear) {
+        status = Triangulation__extrapolate(
+            triangulation,
+            walkedPolygon,
+            u,
+            (Points) this,
+            (Points__get_coordinates*) DelaunayTable__get_coordinates,
+            polygon,
+            workspace
+        );
+    }
+
+    return status;
+}
+
+static int DelaunayTable__locate_from_hint(
+    const DelaunayTable* const this,
+    const double* const u,
+          size_t* const hint,
+          QueryWorkspace* const workspace
+) {
+    int status = SUCCESS;
+
+    size_t polygon;
+
+    // Walk from the hint, inputs of time steps are usually in the same or a neighboring polygon
+    if (*hint < (this->triangulation->nPolygons)) {
+        status = DelaunayTable__locate(
+            this,
+            *hint,
+            u,
+            &polygon,
+            workspace
+        );
+        if (!status) {
+            *hint = polygon;
+            return status;
+        }
+    }
+
+    status = DelaunayTable__locate(
+        this,
+        Triangulation__jump(
+            this->triangulation,
+            u,
+            (Points) this,
+            (Points__get_coordinates*) DelaunayTable__get_coordinates
+        ),
+        u,
+        &polygon,
+        workspace
+    );
+
+    *hint = (status) ? noPolygon : polygon;
+
+    return status;
+}
+
+static void DelaunayTable__interpolate_rows(
+    const DelaunayTable* const this,
+    const size_t polygon,
+    const size_t nOut,
+    const size_t outputStride,
+    const double* const outputs,
+          double* const y,
+          QueryWorkspace* const workspace
+) {
+    const size_t nDim = this->nIn;
+
+    const double** const rows = workspace->values;
+    for (size_t iVertex = 0 ; iVertex < nVerticesInPolygon(nDim) ; iVertex++) {
+        const size_t iPoint = Triangulation__vertices(this->triangulation, polygon)[iVertex];
+        rows[iVertex] = outputs + outputStride * (iPoint - tablePointBegin(this));
+    }
+
+    DelaunayTable__weighted_sum(
+        nVerticesInPolygon(nDim),
+        nOut,
+        rows,
+        workspace->divisionRatio,
+        y
+    );
+}
+
+static int DelaunayTable__interpolate(
+    const DelaunayTable* const this,
+    const size_t startPolygon,
+    const double* const u,
+          double* const y,
+          size_t* const polygon,
+          QueryWorkspace* const workspace
+) {
+    int status = SUCCESS;
+
+    status = DelaunayTable__locate(
+        this,
+        startPolygon,
+        u,
+        polygon,
+        workspace
+    );
+    if (status) {
+        return status;
+    }
+
+    /// # linear interpolation of y[:] by `divisionRatio`
+    DelaunayTable__interpolate_rows(
+        this,
+        *polygon,
+        this->nOut,
+        (this->outputs) ? (this->outputStride) : (this->nIn + this->nOut),
+        (this->outputs) ? (this->outputs)      : (this->table + this->nIn),
+        y,
+        workspace
+    );
+
+    return SUCCESS;
+}
+
+static int DelaunayTable__interpolate_in_order(
+    const DelaunayTable* const this,
+    const size_t* const order,
+    const size_t nValues,
+    const double* const u,
+          double* const y,
+          int*    const statuses,
+          QueryWorkspace* const workspace
+) {
+    const size_t nIn  = this->nIn;
+    const size_t nOut = this->nOut;
+
+    int status = SUCCESS;
+
+    // Each walk starts from the polygon found for the previous input
+    size_t previousPolygon = noPolygon;
+
+    for (size_t i = 0 ; i < nValues ; i++) {
+        const size_t iValue = order[i];
+        const double* const u_i = &u[iValue * nIn];
+
+        const size_t startPolygon = (previousPolygon != noPolygon)
+            ? previousPolygon
+            : Triangulation__jump(
+                this->triangulation,
+                u_i,
+                (Points) this,
+                (Points__get_coordinates*) DelaunayTable__get_coordinates
+            );
+
+        size_t polygon;
+
+        const int valueStatus = DelaunayTable__interpolate(
+            this,
+            startPolygon,
+            u_i,
+            &y[iValue * nOut],
+            &polygon,
+            workspace
+        );
+
+        if (statuses) {statuses[iValue] = valueStatus;}
+        if (valueStatus) {status = FAILURE;}
+
+        previousPolygon = (valueStatus) ? noPolygon : polygon;
+    }
+
+    return status;
+}
+
 static void DelaunayTable__extend_table(
     DelaunayTable* this
 ) {
@@ -212,7 +939,7 @@ static void DelaunayTable__extend_table(
         }
     }
 
-    const double big_coordinate = 2.0 * (double) nDim * maxAbs;
+    const double big_coordinate = bigPolygonScale * 2.0 * (double) nDim * maxAbs;
     // Assign extended table data
     for (size_t iPoint = 0 ; iPoint < nVerticesInPolygon(nDim) ; iPoint++) {
         double* const coords = (this->table_extended) + iPoint * nDim;
@@ -229,6 +956,110 @@ static void DelaunayTable__extend_table(
     }
 }
 
+static int DelaunayTable__pack_rows(
+    const DelaunayTable* const this,
+    const size_t nOut,
+    const double* const source,
+    const size_t sourceStride,
+          size_t* const outputStride,
+          double** const outputs,
+          void** const block
+) {
+    // Rows as wide as an aligned block are padded, narrow rows are packed densely
+    const size_t nOutInBlock = outputAlignment / sizeof(double);
+    const size_t stride = (nOut >= nOutInBlock)
+        ? (nOut + nOutInBlock - 1) / nOutInBlock * nOutInBlock
+        : nOut;
+
+    void* const allocation = MALLOC(tablePointSize(this) * stride * sizeof(double) + outputAlignment);
+    if (!allocation) {return FAILURE;}
+
+    const uintptr_t address = (uintptr_t) allocation;
+    double* const rows = (double*) (
+        (address + outputAlignment - 1) / outputAlignment * outputAlignment
+    );
+
+    for (size_t iPoint = 0 ; iPoint < tablePointSize(this) ; iPoint++) {
+        const double* const sourceRow = source + sourceStride * iPoint;
+        double* const row = rows + stride * iPoint;
+        for (size_t iOut = 0 ; iOut < stride ; iOut++) {
+            row[iOut] = (iOut < nOut) ? sourceRow[iOut] : 0.0;
+        }
+    }
+
+    *outputStride = stride;
+    *outputs      = rows;
+    *block        = allocation;
+
+    return SUCCESS;
+}
+
+static void DelaunayTable__pack_outputs(
+    DelaunayTable* const this,
+    ResourceStack resources
+) {
+    const int status = DelaunayTable__pack_rows(
+        this,
+        this->nOut,
+        this->table + this->nIn,
+        this->nIn + this->nOut,
+        &(this->outputStride),
+        &(this->outputs),
+        &(this->outputsBlock)
+    );
+    if (status) {
+        raise_Error(resources, "DelaunayTable__pack_rows(...) failed");
+    }
+}
+
+static void DelaunayTable__locate_points(
+    const DelaunayTable* const this,
+    const PolygonTreeVector* const polygonTreeVector,
+    const size_t rootPolygon,
+    const size_t nPoints,
+    const size_t* const pointsToLocate,
+    const size_t nThreads,
+    size_t* const locatedPolygons
+) {
+    const size_t nDim    = this->nIn;
+    const long   nLocate = (long) nPoints;
+
+    #pragma omp parallel num_threads(nThreads)
+    {
+        // If allocation failed, points are searched again from `rootPolygon`
+        double* const divisionRatio = (double*) MALLOC(
+            nVerticesInPolygon(nDim) * sizeof(double)
+        );
+        const double** const shape = (const double**) MALLOC(
+            nVerticesInPolygon(nDim) * sizeof(double*)
+        );
+
+        #pragma omp for schedule(dynamic)
+        for (long i = 0 ; i < nLocate ; i++) {
+            size_t polygon = noPolygon;
+
+            if (divisionRatio && shape) {
+                const int status = PolygonTreeVector__find(
+                    polygonTreeVector,
+                    rootPolygon,
+                    DelaunayTable__get_coordinates(this, pointsToLocate[i]),
+                    (Points) this,
+                    (Points__get_coordinates*) DelaunayTable__get_coordinates,
+                    &polygon,
+                    divisionRatio,
+                    shape
+                );
+                if (status) {polygon = noPolygon;}
+            }
+
+            locatedPolygons[i] = polygon;
+        }
+
+        if (divisionRatio) {FREE(divisionRatio);}
+        if (shape)         {FREE(shape);}
+    }
+}
+
 static void DelaunayTable__delaunay_divide(
     DelaunayTable* this,
     const enum Verbosity verbosity,
@@ -238,87 +1069,176 @@ static void DelaunayTable__delaunay_divide(
 
     int status = SUCCESS;
 
-    // Assertion polygonTreeVector must be empty
-    if ( (this->polygonTreeVector->size) != 0 ) {
-        raise_Error(resources, "duplicate call of DelaunayTable__delaunay_divide()");
-    }
-
     const size_t nDim = this->nIn;
 
-    IndexVector* face = ResourceStack__ensure_delete_finally(
+    PolygonTreeVector* const polygonTreeVector = ResourceStack__ensure_delete_finally(
         resources,
-        IndexVector__new(nVerticesInFace(nDim)),
-        IndexVector__delete
+        PolygonTreeVector__new(nDim),
+        PolygonTreeVector__delete
     );
 
     // Setup bigPolygon as root of polygonTree
-    PolygonTree* const bigPolygon = PolygonTree__new(nDim);
-    if (!bigPolygon) {
-        raise_Error(resources, "PolygonTree__new(nDim) failed");
-    }
+    const size_t bigPolygon = 0;
 
-    status = PolygonTreeVector__append(this->polygonTreeVector, bigPolygon);
+    status = PolygonTreeVector__append(polygonTreeVector, 1);
     if (status) {
-        PolygonTree__delete(bigPolygon);
-        raise_Error(resources, "failed to append bigPolygon to this->polygonTreeVector");
+        raise_Error(resources, "failed to append bigPolygon to polygonTreeVector");
     }
 
+    // bigPolygon has no neighbors
+    size_t* const bigVertices  = PolygonTreeVector__vertices (polygonTreeVector, bigPolygon);
+    size_t* const bigNeighbors = PolygonTreeVector__neighbors(polygonTreeVector, bigPolygon);
     for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
-        bigPolygon->vertices[i] = extendedPointBegin(this) + i;
+        bigVertices [i] = extendedPointBegin(this) + i;
+        bigNeighbors[i] = noPolygon;
     }
 
-    for (size_t iEx = 0 ; iEx < nVerticesInPolygon(nDim) ; iEx++) {
-        // Set vertices of face
-        for (size_t i = 0 ; i < nVerticesInFace(nDim) ; i++) {
-            if (i < iEx) {
-                IndexVector__elements(face)[i] = bigPolygon->vertices[i+0];
+    size_t* const insertionOrder = ResourceStack__ensure_delete_finally(
+        resources,
+        MALLOC(tablePointSize(this) * sizeof(size_t)),
+        FREE
+    );
+
+    status = InsertionOrder__arrange(
+        this->options.insertionOrder,
+        nDim,
+        tablePointBegin(this),
+        tablePointEnd(this),
+        (Points) this,
+        (Points__get_coordinates*) DelaunayTable__get_coordinates,
+        insertionOrder
+    );
+    if (status) {
+        raise_Error(resources, "InsertionOrder__arrange(...) failed");
+    }
+
+    /**
+     * Points are divided in batches.
+     * Each batch is first located concurrently on the (read-only) polygon tree,
+     * then inserted one by one.
+     * Only leaves of the polygon tree get children, so searching again from
+     * the located polygon gives the same result as searching from `bigPolygon`.
+     */
+    const size_t nThreads  = (
+        (this->options.locator == Locator__history) && (this->options.nThreads > 1)
+    ) ? this->options.nThreads : 1;
+    const size_t batchSize = (nThreads > 1) ? nThreads * nPointsToLocatePerThread : 1;
+
+    size_t* const locatedPolygons = ResourceStack__ensure_delete_finally(
+        resources,
+        MALLOC(batchSize * sizeof(size_t)),
+        FREE
+    );
+
+    for (
+        size_t batchBegin = 0;
+        batchBegin < tablePointSize(this);
+        batchBegin += batchSize
+    ) {
+        const size_t batchEnd = (batchBegin + batchSize < tablePointSize(this))
+            ? batchBegin + batchSize
+            : tablePointSize(this);
+
+        if (nThreads > 1) {
+            DelaunayTable__locate_points(
+                this,
+                polygonTreeVector,
+                bigPolygon,
+                batchEnd - batchBegin,
+                insertionOrder + batchBegin,
+                nThreads,
+                locatedPolygons
+            );
+        }
+
+        for (size_t iOrder = batchBegin ; iOrder < batchEnd ; iOrder++) {
+            const size_t pointToDivide = insertionOrder[iOrder];
+
+            if (verbosity >= Verbosity__debug) {
+                Runtime__send_message(
+                    "Divide polygon tree (contains %6lu polygons) by point [%3lu]",
+                    polygonTreeVector->size,
+                    pointToDivide+1
+                );
+            }
+
+            size_t startPolygon;
+            if (this->options.locator == Locator__history) {
+                startPolygon = (nThreads > 1 && locatedPolygons[iOrder - batchBegin] != noPolygon)
+                    ? locatedPolygons[iOrder - batchBegin]
+                    : bigPolygon;
             } else {
-                IndexVector__elements(face)[i] = bigPolygon->vertices[i+1];
+                // The last inserted polygon is never divided yet
+                startPolygon = polygonTreeVector->size - 1;
             }
+
+            PolygonTreeVector__divide_at_point(
+                polygonTreeVector,
+                pointToDivide,
+                this,
+                (Points__get_coordinates*) DelaunayTable__get_coordinates,
+                startPolygon,
+                this->options.locator,
+                this->options.inserter,
+                verbosity,
+                resources
+            );
         }
+    }
 
-        // Set to neighborPairMap
-        Neighbor neighborPair[2] = {
-            {bigPolygon->vertices[iEx], bigPolygon},
-            {-1                       , NULL      }
-        };
+    // Compact current polygons, the history is deleted on exit
+    this->triangulation = ResourceStack__ensure_delete_on_error(
+        resources,
+        Triangulation__from_polygonTreeVector(polygonTreeVector),
+        Triangulation__delete
+    );
 
-        status = NeighborPairMap__set(
-            this->neighborPairMap,
-            face,
-            neighborPair
+    status = Triangulation__find_hullNeighbors(
+        this->triangulation,
+        tablePointSize(this)
+    );
+    if (status) {
+        raise_Error(resources, "Triangulation__find_hullNeighbors(...) failed");
+    }
+
+    if (this->options.extrapolation == Extrapolation__linear) {
+        status = Triangulation__build_hullIndex(
+            this->triangulation,
+            tablePointSize(this)
         );
         if (status) {
-            raise_Error(
-                resources,
-                "failed to set face => neighborPair to this->neighborPairMap"
-            );
+            raise_Error(resources, "Triangulation__build_hullIndex(...) failed");
         }
     }
 
-    for (
-        size_t pointToDivide = tablePointBegin(this);
-        pointToDivide < tablePointEnd(this);
-        pointToDivide++
-    ) {
-        if (verbosity >= Verbosity__debug) {
-            Runtime__send_message(
-                "Divide polygon tree (contains %6lu polygons) by point [%3lu]",
-                this->polygonTreeVector->size,
-                pointToDivide+1
-            );
+    if (this->options.query == Query__precomputed) {
+        status = Triangulation__precompute_transforms(
+            this->triangulation,
+            this,
+            (Points__get_coordinates*) DelaunayTable__get_coordinates
+        );
+        if (status) {
+            raise_Error(resources, "Triangulation__precompute_transforms(...) failed");
         }
+    }
 
-        PolygonTreeVector__divide_at_point(
-            nDim,
-            this->polygonTreeVector,
-            pointToDivide,
+    if (this->options.queryIndex == QueryIndex__grid) {
+        status = Triangulation__build_grid(
+            this->triangulation,
             this,
             (Points__get_coordinates*) DelaunayTable__get_coordinates,
-            bigPolygon,
-            this->neighborPairMap,
-            verbosity,
-            resources
+            tablePointSize(this)
+        );
+        if (status) {
+            raise_Error(resources, "Triangulation__build_grid(...) failed");
+        }
+    }
+
+    if (verbosity >= Verbosity__info) {
+        Runtime__send_message(
+            "Delaunay divided into %lu polygons (%lu polygons created)",
+            this->triangulation->nPolygons,
+            polygonTreeVector->size
         );
     }
 
@@ -327,29 +1247,23 @@ static void DelaunayTable__delaunay_divide(
 
 static inline bool polygon_on_table(
     const DelaunayTable* const this,
-    const PolygonTree* const polygon
+    const size_t polygon
 ) {
     const size_t nDim = this->nIn;
 
-    for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
-        const bool vertexOnTable = (
-            polygon->vertices[i] >= tablePointBegin(this) &&
-            polygon->vertices[i] <  tablePointEnd(this)
-        );
-        if (!vertexOnTable) {return false;}
-    }
-
-    return true;
+    // Vertices are sorted, extended points are the last ones
+    return Triangulation__vertices(this->triangulation, polygon)[nDim] < tablePointEnd(this);
 }
 
 int ensure_polygon_on_table(
     const DelaunayTable* const this,
     const double* const coordinates,
-    PolygonTree** const polygon,
-    double* const divisionRatio
+    size_t* const polygon,
+    QueryWorkspace* const workspace
 ) {
     const size_t nDim = this->nIn;
-    PolygonTree* const previousPolygon = *polygon;
+    const size_t previousPolygon = *polygon;
+    const double* const divisionRatio = workspace->divisionRatio;
 
     // Early return
     // [1] if all vertices on table -> success (do nothing)
@@ -363,74 +1277,93 @@ int ensure_polygon_on_table(
 
     int status = SUCCESS;
 
-    IndexVector*       overlapVertices = NULL;
-    PolygonTreeVector* aroundPolygons  = NULL;
+    // [3] on the hull facet opposite to the only extended vertex -> polygon across the facet
+    const size_t hullNeighbor = (this->triangulation->hullNeighbors)
+        ? (this->triangulation->hullNeighbors)[previousPolygon]
+        : noPolygon;
 
-    overlapVertices = IndexVector__new(0);
-    if (!overlapVertices) {
-        status = FAILURE; goto finally;
+    bool onHullFacet = (hullNeighbor != noPolygon);
+    for (size_t i = 0 ; i < nVerticesInPolygon(nDim) && onHullFacet ; i++) {
+        const int sign = double__compare(divisionRatio[i], 0.0);
+        onHullFacet = (i == nDim) ? (sign == 0) : (sign > 0);
     }
 
-    aroundPolygons = PolygonTreeVector__new(0);
-    if (!aroundPolygons) {
-        status = FAILURE; goto finally;
+    if (onHullFacet) {
+        // Ratios of shared vertices are kept, the vertex across the facet gets 0.
+        // Both vertices are sorted, the extended vertex (last) is replaced by the one at `k`
+        const size_t* const vertices         = Triangulation__vertices(this->triangulation, previousPolygon);
+        const size_t* const neighborVertices = Triangulation__vertices(this->triangulation, hullNeighbor);
+
+        size_t k = 0;
+        while (k < nDim && neighborVertices[k] == vertices[k]) {k++;}
+
+        double* const ratio = workspace->divisionRatio;
+        for (size_t i = nDim ; i > k ; i--) {
+            ratio[i] = ratio[i-1];
+        }
+        ratio[k] = 0.0;
+
+        *polygon = hullNeighbor;
+        return SUCCESS;
     }
 
+    // otherwise polygons around the face are searched
+
+    if (!(workspace->overlapVertices)) {
+        workspace->overlapVertices = IndexVector__new(0);
+        if (!(workspace->overlapVertices)) {return FAILURE;}
+    }
+    if (!(workspace->aroundPolygons)) {
+        workspace->aroundPolygons = IndexVector__new(0);
+        if (!(workspace->aroundPolygons)) {return FAILURE;}
+    }
+
+    IndexVector* const overlapVertices = workspace->overlapVertices;
+    IndexVector* const aroundPolygons  = workspace->aroundPolygons;
+
+    IndexVector__clear(overlapVertices);
+    IndexVector__clear(aroundPolygons);
+
     for (size_t i = 0 ; i < nVerticesInPolygon(nDim) ; i++) {
         if (double__compare(divisionRatio[i], 0.0) != 0) {
             status = IndexVector__append(
                 overlapVertices,
-                previousPolygon->vertices[i]
+                Triangulation__vertices(this->triangulation, previousPolygon)[i]
             );
-            if (status) {
-                goto finally;
-            }
+            if (status) {return status;}
         }
     }
 
-    status = PolygonTree__get_around(
-        nDim,
+    status = Triangulation__get_around(
+        this->triangulation,
         previousPolygon,
         overlapVertices,
-        this->neighborPairMap,
         aroundPolygons
     );
-    if (status) {
-        goto finally;
-    }
+    if (status) {return status;}
 
     // return first polygon on table
     for (size_t i = 0 ; i < (aroundPolygons->size) ; i++) {
-        PolygonTree* const candidate
-            = PolygonTreeVector__elements(aroundPolygons)[i];
+        const size_t candidate = IndexVector__elements(aroundPolygons)[i];
 
-        if (candidate == previousPolygon)      {continue;}
+        if (candidate == previousPolygon)       {continue;}
         if (!polygon_on_table(this, candidate)) {continue;}
 
-        status = PolygonTree__calculate_divisionRatio(
-            nDim,
+        status = Triangulation__calculate_divisionRatio(
+            this->triangulation,
             candidate,
             coordinates,
             (Points) this,
             (Points__get_coordinates*) DelaunayTable__get_coordinates,
-            divisionRatio
+            workspace
         );
-        if (status) {
-            goto finally;
-        }
+        if (status) {return status;}
 
         *polygon = candidate;
-        goto finally;
+        return SUCCESS;
     }
 
     // polygon on table not found -> failure
-    *polygon = NULL;
-    status = FAILURE;
-
-finally:
-
-    if (overlapVertices) {IndexVector__delete(overlapVertices);}
-    if (aroundPolygons)  {PolygonTreeVector__delete(aroundPolygons);}
-
-    return status;
+    *polygon = noPolygon;
+    return FAILURE;
 }
@@ -2,21 +2,137 @@
 #pragma once
 
 #include "DelaunayTable.PolygonTree.h"
+#include "DelaunayTable.InsertionOrder.h"
+#include "DelaunayTable.Triangulation.h"
 
 #include "DelaunayTable.ResourceStack.h"
 
 #include <stddef.h>
 
 
-/// # DelaunayTable
+/// # OutputLayout
+enum OutputLayout {
+    OutputLayout__table = 1,  /// read outputs from rows of the table, after inputs
+    OutputLayout__packed      /// read outputs from rows repacked after construction, see `DelaunayTable__pack_outputs`
+};
+
+
+/// # DelaunayTableOptions
+typedef struct {
+    /**
+     * Number of threads locating points in the history while `DelaunayTable__delaunay_divide`.
+     * Points are located concurrently in batches, then inserted (and flipped) in order by one thread,
+     * so the triangulation does not depend on `nThreads`.
+     * Construction is not parallel: insertion, flips and cavities are serial,
+     * and the history locator is slower than the default `Locator__walk` (see `benchmarkDelaunayDivide__scaling`).
+     * Values greater than 1 require `locator` of `Locator__history`
+     * (`DelaunayTable__from_buffer` raises an error otherwise),
+     * and take effect only when compiled with OpenMP.
+     */
+    size_t nThreads;
+
+    /// Order of table points inserted by `DelaunayTable__delaunay_divide`
+    enum InsertionOrder insertionOrder;
+
+    /**
+     * Point location while construction.
+     * `Locator__history` descends the children of divided polygons from the root,
+     * `Locator__walk` walks from the last inserted polygon.
+     */
+    enum Locator locator;
+
+    /**
+     * Point insertion while construction.
+     * `Inserter__flip` divides the polygon containing the point and flips faces,
+     * it only flips one face into `nIn` polygons (2-to-n flip),
+     * so it is rejected for `nIn` >= 3 where 3-to-2 flips are needed.
+     * `Inserter__cavity` re-stars the cavity of the point in one pass,
+     * which works in any dimension.
+     */
+    enum Inserter inserter;
+
+    /**
+     * Division ratios while queries.
+     * `Query__solve` solves them per visited polygon,
+     * `Query__precomputed` precomputes barycentric transforms of all polygons after construction,
+     * queries become matrix-vector products at the cost of nIn*nIn doubles per polygon.
+     */
+    enum Query query;
+
+    /**
+     * Start polygons of walks while queries.
+     * `QueryIndex__jump` samples polygons per query,
+     * `QueryIndex__grid` builds a uniform grid after construction (one polygon index per cell),
+     * the start polygon is found by a cell lookup and walks take a few steps.
+     */
+    enum QueryIndex queryIndex;
+
+    /**
+     * Inputs out of the convex hull of the table while queries.
+     * `Extrapolation__none` fails,
+     * `Extrapolation__linear` extends the boundary polygon nearest to the input linearly,
+     * boundary polygons of polygons out of the hull are indexed after construction.
+     * Inputs out of the big polygon (far from the table) fail in any case.
+     */
+    enum Extrapolation extrapolation;
+
+    /**
+     * Outputs while queries.
+     * `OutputLayout__table` (default) reads outputs from the table as given, without a copy.
+     * `OutputLayout__packed` (opt-in) repacks outputs of each point into a row of its own,
+     * aligned and padded for SIMD when `nOut` is wide,
+     * queries interpolate by a weighted sum of nIn+1 contiguous rows (nPoints*nOut doubles more).
+     */
+    enum OutputLayout outputLayout;
+} DelaunayTableOptions;
+
+static inline DelaunayTableOptions DelaunayTableOptions__default(
+) {
+    const DelaunayTableOptions options = {
+        1,                    // nThreads
+        InsertionOrder__brio, // insertionOrder
+        Locator__walk,        // locator
+        Inserter__cavity,     // inserter
+        Query__solve,         // query
+        QueryIndex__jump,     // queryIndex
+        Extrapolation__none,  // extrapolation
+        OutputLayout__table   // outputLayout
+    };
+    return options;
+}
+
+
+/** # DelaunayTableOutputs
+ * Outputs attached to a table by `DelaunayTable__attach_outputs`,
+ * row of point `iPoint` is `outputs[iPoint * outputStride ...]`.
+ */
+typedef struct {
+    size_t  nOut;
+    size_t  outputStride;
+    const double* outputs;
+    void*         outputsBlock;  /// allocation of packed `outputs`, NULL if they are of the caller
+} DelaunayTableOutputs;
+
+
+/** # DelaunayTable
+ * Thread safety: a table is not modified after `DelaunayTable__from_buffer`,
+ * `DelaunayTable__get_value*` and `DelaunayTable__get_values*` may be called concurrently
+ * on one table from any threads, as long as hints and `QueryWorkspace`s are not shared.
+ * `DelaunayTable__delete` must not run concurrently with them.
+ */
 typedef struct{
     size_t nPoints;
     size_t nIn;
     size_t nOut;
     const double* table;
           double* table_extended;
-    PolygonTreeVector* polygonTreeVector;
-    NeighborPairMap*   neighborPairMap;
+    DelaunayTableOptions options;
+    Triangulation* triangulation;
+    size_t  outputStride;   /// doubles between rows of `outputs`, nOut or padded
+    double* outputs;        /// double[nPoints][outputStride] or NULL, aligned by `outputAlignment`
+    void*   outputsBlock;   /// allocation of `outputs`
+    size_t nAttached;
+    DelaunayTableOutputs* attached;  /// DelaunayTableOutputs[nAttached]
 } DelaunayTable;
 
 
@@ -26,6 +142,7 @@ extern DelaunayTable* DelaunayTable__from_buffer(
     const size_t nIn,
     const size_t nOut,
     const double* buffer,
+    const DelaunayTableOptions* options,  // NULL means default options
     const enum Verbosity verbosity,
     ResourceStack resources
 );
@@ -34,6 +151,11 @@ extern void DelaunayTable__delete(
     DelaunayTable* this
 );
 
+/**
+ * Value `y` at `u`, its workspace is on the stack for `nIn` up to 9 and allocated per call above,
+ * vectors for `u` on faces are still allocated per call.
+ * Repeated queries should use `DelaunayTable__get_value_in_workspace`.
+ */
 extern int DelaunayTable__get_value(
     DelaunayTable* this,
     size_t nIn,
@@ -42,6 +164,135 @@ extern int DelaunayTable__get_value(
           double* y
 );
 
+/**
+ * `DelaunayTable__get_value` walking from `hint`, the polygon found by the previous call.
+ * Falls back to the jump & walk from sampled polygons if the walk from `hint` fails,
+ * so the result does not depend on `hint`.
+ * `hint` is owned by each caller, `noPolygon` (or any invalid polygon) means no hint.
+ * It receives the polygon containing `u`, or `noPolygon` on failure.
+ */
+extern int DelaunayTable__get_value_from_hint(
+    DelaunayTable* this,
+    size_t nIn,
+    size_t nOut,
+    const double* u,
+          double* y,
+          size_t* hint
+);
+
+/**
+ * `DelaunayTable__get_value_from_hint` in `workspace` of the caller,
+ * created by `QueryWorkspace__new(nIn)` once per thread and reused.
+ * Queries in a workspace do not allocate memory (after vectors for inputs on faces have grown).
+ */
+extern int DelaunayTable__get_value_in_workspace(
+    DelaunayTable* this,
+    size_t nIn,
+    size_t nOut,
+    const double* u,
+          double* y,
+          size_t* hint,
+          QueryWorkspace* workspace
+);
+
+/**
+ * `DelaunayTable__get_value_in_workspace` with the jacobian `dy_du` (double[nOut][nIn]),
+ * `dy_du[iOut][i]` is the derivative of `y[iOut]` with respect to `u[i]`.
+ * The interpolation is affine in each polygon, the jacobian is that of the polygon found
+ * (one of polygons on a face if `u` is on it).
+ */
+extern int DelaunayTable__get_value_and_jacobian(
+    DelaunayTable* this,
+    size_t nIn,
+    size_t nOut,
+    const double* u,
+          double* y,
+          double* dy_du,
+          size_t* hint,
+          QueryWorkspace* workspace
+);
+
+/**
+ * Attach `outputs` (double[nPoints][nOut]) of another table with the same inputs,
+ * tables of identical input columns share the triangulation of `this`
+ * (build it from inputs only, with `nOut` of 0, and attach outputs of each table).
+ * Fails if `this` has outputs of its own, they would not be interpolated with attached ones.
+ * Outputs are repacked with `OutputLayout__packed`, otherwise `outputs` is kept by reference.
+ * `iAttached` (nullable) receives the index of the outputs.
+ * Must not run concurrently with queries.
+ */
+extern int DelaunayTable__attach_outputs(
+    DelaunayTable* this,
+    size_t nOut,
+    const double* outputs,
+    size_t* iAttached
+);
+
+/**
+ * Values `y` (double[nOut]) of the attached outputs `iAttached` at `u`,
+ * `hint` and `workspace` are those of `DelaunayTable__get_value_in_workspace`.
+ */
+extern int DelaunayTable__get_attached_value(
+    DelaunayTable* this,
+    size_t nIn,
+    size_t iAttached,
+    size_t nOut,
+    const double* u,
+          double* y,
+          size_t* hint,
+          QueryWorkspace* workspace
+);
+
+/**
+ * Values of all attached outputs at `u` by one locate,
+ * `y[iAttached]` is double[nOut] of the outputs `iAttached`.
+ * `hint` and `workspace` are those of `DelaunayTable__get_value_in_workspace`.
+ */
+extern int DelaunayTable__get_attached_values(
+    DelaunayTable* this,
+    size_t nIn,
+    const double* u,
+          double* const* y,
+          size_t* hint,
+          QueryWorkspace* workspace
+);
+
+/**
+ * Values at `nValues` inputs, `u` is double[nValues][nIn] and `y` is double[nValues][nOut].
+ * Inputs are evaluated in the order along a hilbert curve,
+ * and each walk starts from the polygon found for the previous input.
+ * `statuses` (int[nValues], nullable) receives the status of each input,
+ * fails if any of inputs fails.
+ */
+extern int DelaunayTable__get_values(
+    DelaunayTable* this,
+    size_t nIn,
+    size_t nOut,
+    size_t nValues,
+    const double* u,
+          double* y,
+          int*    statuses
+);
+
+/**
+ * `DelaunayTable__get_values` by `nThreads` threads (0 means 1).
+ * Inputs in the hilbert order are split into chunks,
+ * which are taken by threads as they become idle (OpenMP dynamic schedule).
+ * Without OpenMP, inputs are evaluated by the calling thread.
+ * Speedup over threads is not verified yet, it has been measured on a single processor only
+ * (see `benchmarkQuery__parallel`).
+ */
+extern int DelaunayTable__get_values_parallel(
+    DelaunayTable* this,
+    size_t nIn,
+    size_t nOut,
+    size_t nValues,
+    const double* u,
+          double* y,
+          int*    statuses,
+    size_t nThreads
+);
+
 /// ## DelaunayTable properties
 static inline size_t tablePointSize     (const DelaunayTable* const this) {return this->nPoints;}
 static inline size_t extendedPointSize  (const DelaunayTable* const this) {return nVerticesInPolygon(this->nIn);}
@@ -0,0 +1,118 @@
+/**
+ * Build time and query time of `nTables` tables of the same inputs,
+ * built separately against one triangulation with attached outputs.
+ *
+ * usage: benchmarkAttach__outputs [nIn [nPoints [nQueries]]]
+ */
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include "Benchmark.h"
+
+
+#define maxTables (16)
+
+int main(int argc, char** argv) {
+    const size_t nIn      = Benchmark__argument(argc, argv, 1, 3);
+    const size_t nPoints  = Benchmark__argument(argc, argv, 2, 5000);
+    const size_t nQueries = Benchmark__argument(argc, argv, 3, 100000);
+    const size_t nOut     = 4;
+
+    printf("# nIn = %zu, nPoints = %zu, nQueries = %zu, nOut = %zu per table\n", nIn, nPoints, nQueries, nOut);
+    printf("%7s %14s %14s %14s %14s\n", "nTables", "separate.build", "shared.build", "separate.query", "shared.query");
+
+    double* const table = Benchmark__random_table(nPoints , nIn, nOut, 1);
+    double* const u     = Benchmark__random_table(nQueries, nIn, 0   , 2);
+
+    // Inputs and outputs of the table in separate buffers
+    double* const inputs  = (double*) malloc(nPoints * nIn  * sizeof(double));
+    double* const outputs = (double*) malloc(nPoints * nOut * sizeof(double));
+    double* const y       = (double*) malloc(maxTables * nOut * sizeof(double));
+    if (!inputs || !outputs || !y) {return EXIT_FAILURE;}
+
+    for (size_t iPoint = 0 ; iPoint < nPoints ; iPoint++) {
+        for (size_t i = 0 ; i < nIn ; i++) {
+            inputs[iPoint * nIn + i] = table[iPoint * (nIn + nOut) + i];
+        }
+        for (size_t iOut = 0 ; iOut < nOut ; iOut++) {
+            outputs[iPoint * nOut + iOut] = table[iPoint * (nIn + nOut) + nIn + iOut];
+        }
+    }
+    for (size_t i = 0 ; i < nQueries * nIn ; i++) {
+        u[i] *= 0.9;
+    }
+
+    double* ys[maxTables];
+    for (size_t iTable = 0 ; iTable < maxTables ; iTable++) {
+        ys[iTable] = y + iTable * nOut;
+    }
+
+    for (size_t nTables = 1 ; nTables <= maxTables ; nTables *= 2) {
+        ResourceStack resources = ResourceStack__new();
+
+        QueryWorkspace* const workspace = ResourceStack__ensure_delete_finally(
+            resources,
+            QueryWorkspace__new(nIn),
+            QueryWorkspace__delete
+        );
+
+        // Separate tables, each is delaunay divided
+        DelaunayTable* separate[maxTables];
+
+        double begin = Benchmark__now();
+        for (size_t iTable = 0 ; iTable < nTables ; iTable++) {
+            separate[iTable] = ResourceStack__ensure_delete_finally(
+                resources,
+                DelaunayTable__from_buffer(nPoints, nIn, nOut, table, NULL, Verbosity__quiet, resources),
+                DelaunayTable__delete
+            );
+        }
+        const double separateBuild = Benchmark__now() - begin;
+
+        // One triangulation with attached outputs
+        begin = Benchmark__now();
+        DelaunayTable* const shared = ResourceStack__ensure_delete_finally(
+            resources,
+            DelaunayTable__from_buffer(nPoints, nIn, 0, inputs, NULL, Verbosity__quiet, resources),
+            DelaunayTable__delete
+        );
+        for (size_t iTable = 0 ; iTable < nTables ; iTable++) {
+            if (DelaunayTable__attach_outputs(shared, nOut, outputs, NULL)) {return EXIT_FAILURE;}
+        }
+        const double sharedBuild = Benchmark__now() - begin;
+
+        // Random inputs, walks start from sampled polygons
+        begin = Benchmark__now();
+        for (size_t iQuery = 0 ; iQuery < nQueries ; iQuery++) {
+            for (size_t iTable = 0 ; iTable < nTables ; iTable++) {
+                size_t hint = noPolygon;
+                DelaunayTable__get_value_in_workspace(
+                    separate[iTable], nIn, nOut, &u[iQuery * nIn], ys[iTable], &hint, workspace
+                );
+            }
+        }
+        const double separateQuery = 1.0e9 * (Benchmark__now() - begin) / (double) nQueries;
+
+        begin = Benchmark__now();
+        for (size_t iQuery = 0 ; iQuery < nQueries ; iQuery++) {
+            size_t hint = noPolygon;
+            DelaunayTable__get_attached_values(shared, nIn, &u[iQuery * nIn], ys, &hint, workspace);
+        }
+        const double sharedQuery = 1.0e9 * (Benchmark__now() - begin) / (double) nQueries;
+
+        printf(
+            "%7zu %12.3f s %12.3f s %11.1f ns %11.1f ns\n",
+            nTables, separateBuild, sharedBuild, separateQuery, sharedQuery
+        );
+
+        ResourceStack__delete(resources);
+    }
+
+    free(table);
+    free(u);
+    free(inputs);
+    free(outputs);
+    free(y);
+
+    return EXIT_SUCCESS;
+}
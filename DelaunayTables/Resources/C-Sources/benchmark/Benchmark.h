@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/// # Timer
+static inline double Benchmark__now(
+) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) now.tv_sec + 1.0e-9 * (double) now.tv_nsec;
+}
+
+
+/// # Random table
+/// deterministic pseudo random number in [-1, +1)
+static inline double Benchmark__random(
+    uint64_t* const state
+) {
+    *state = (*state) * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double) ((*state) >> 11) / (double) (1ULL << 52) - 1.0;
+}
+
+/**
+ * Allocate table[nPoints][nIn+nOut].
+ * Inputs are uniform random in [-1, +1)^nIn,
+ * outputs are linear functions of inputs.
+ */
+static inline double* Benchmark__random_table(
+    const size_t nPoints,
+    const size_t nIn,
+    const size_t nOut,
+    const uint64_t seed
+) {
+    double* const table = (double*) malloc(nPoints * (nIn + nOut) * sizeof(double));
+    if (!table) {
+        fprintf(stderr, "failed to allocate table[%zu][%zu]\n", nPoints, nIn + nOut);
+        exit(EXIT_FAILURE);
+    }
+
+    uint64_t state = seed;
+    for (size_t iPoint = 0 ; iPoint < nPoints ; iPoint++) {
+        double* const row = &table[iPoint * (nIn + nOut)];
+        for (size_t i = 0 ; i < nIn ; i++) {
+            row[i] = Benchmark__random(&state);
+        }
+        for (size_t iOut = 0 ; iOut < nOut ; iOut++) {
+            row[nIn + iOut] = (double) iOut;
+            for (size_t i = 0 ; i < nIn ; i++) {
+                row[nIn + iOut] += (double) (i + iOut + 1) * row[i];
+            }
+        }
+    }
+
+    return table;
+}
+
+/// parse argv[index] as size_t, or return `default_value`
+static inline size_t Benchmark__argument(
+    const int argc,
+    char** const argv,
+    const int index,
+    const size_t default_value
+) {
+    return (index < argc) ? (size_t) strtoul(argv[index], NULL, 10) : default_value;
+}
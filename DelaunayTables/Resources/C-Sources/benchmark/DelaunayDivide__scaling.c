@@ -0,0 +1,75 @@
+/**
+ * Time of `DelaunayTable__from_buffer` over `options.nThreads` (with `Locator__history`),
+ * against the serial default (`Locator__walk`, 1 thread).
+ * Only the location of points in the history is parallel, insertion, flips and cavities stay serial,
+ * so construction does not scale with threads. The speedup column is relative to the serial default.
+ *
+ * usage: benchmarkDelaunayDivide__scaling [nIn [nPoints [maxThreads]]]
+ */
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include "Benchmark.h"
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+
+static double measure(
+    const size_t nPoints,
+    const size_t nIn,
+    const size_t nOut,
+    const double* const table,
+    const DelaunayTableOptions* const options
+) {
+    ResourceStack resources = ResourceStack__new();
+
+    const double begin = Benchmark__now();
+    ResourceStack__ensure_delete_finally(
+        resources,
+        DelaunayTable__from_buffer(nPoints, nIn, nOut, table, options, Verbosity__quiet, resources),
+        DelaunayTable__delete
+    );
+    const double time = Benchmark__now() - begin;
+
+    ResourceStack__delete(resources);
+
+    return time;
+}
+
+int main(int argc, char** argv) {
+    const size_t nIn        = Benchmark__argument(argc, argv, 1, 2);
+    const size_t nPoints    = Benchmark__argument(argc, argv, 2, 100000);
+    const size_t maxThreads = Benchmark__argument(argc, argv, 3, 32);
+    const size_t nOut       = 1;
+
+#if defined(_OPENMP)
+    const int nProcs = omp_get_num_procs();
+#else
+    const int nProcs = 1;  // without OpenMP, `nThreads` is ignored
+#endif
+
+    double* const table = Benchmark__random_table(nPoints, nIn, nOut, 1);
+
+    printf("# nIn = %zu, nPoints = %zu, nProcs = %d\n", nIn, nPoints, nProcs);
+    printf("%10s %10s %12s %10s\n", "locator", "nThreads", "time [s]", "speedup");
+
+    const DelaunayTableOptions serialOptions = DelaunayTableOptions__default();
+    const double serialTime = measure(nPoints, nIn, nOut, table, &serialOptions);
+
+    printf("%10s %10d %12.4f %10.2f\n", "walk", 1, serialTime, 1.0);
+
+    for (size_t nThreads = 1 ; nThreads <= maxThreads ; nThreads *= 2) {
+        DelaunayTableOptions options = DelaunayTableOptions__default();
+        options.nThreads = nThreads;
+        options.locator  = Locator__history;
+
+        const double time = measure(nPoints, nIn, nOut, table, &options);
+
+        printf("%10s %10zu %12.4f %10.2f\n", "history", nThreads, time, serialTime / time);
+    }
+
+    free(table);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,146 @@
+/**
+ * Face matching time of `FaceHashMap` compared with `HashMap` keyed by `IndexVector`.
+ * The trace is taken from a real construction:
+ * faces of all polygons of the triangulation in the order of creation.
+ * Each face is looked up, inserted on the first visit and removed on the second visit,
+ * which is how new polygons are glued together.
+ *
+ * usage: benchmarkFaceHashMap__trace [nIn [nPoints [nRepeat]]]
+ */
+#include "DelaunayTable.h"
+#include "DelaunayTable.FaceHashMap.h"
+#include "DelaunayTable.IndexVector.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include "Benchmark.h"
+
+
+static size_t* size_t__copy(
+    const size_t* const this
+) {
+    size_t* const copied = (size_t*) malloc(sizeof(size_t));
+    if (copied) {*copied = *this;}
+    return copied;
+}
+
+static double trace__HashMap(
+    const size_t nIndices,
+    const size_t nFaces,
+    const size_t* const faces,
+    size_t* const checksum
+) {
+    HashMap* const map = HashMap__new();
+    IndexVector* const face = IndexVector__new(nIndices);
+
+    const double begin = Benchmark__now();
+
+    for (size_t iFace = 0 ; iFace < nFaces ; iFace++) {
+        for (size_t i = 0 ; i < nIndices ; i++) {
+            IndexVector__elements(face)[i] = faces[iFace * nIndices + i];
+        }
+
+        size_t* value;
+        if (HashMap__get(map, face, (Object*) &value, (Object__hash) IndexVector__hash, (Object__equal) IndexVector__equal)) {
+            *checksum += *value;
+            HashMap__remove(map, face, (Object__delete) IndexVector__delete, (Object__hash) IndexVector__hash, (Object__equal) IndexVector__equal, free);
+        } else {
+            const size_t polygon = iFace / (nIndices + 1);
+            HashMap__set(
+                map, face, &polygon,
+                (Object__copy) IndexVector__copy, (Object__delete) IndexVector__delete,
+                (Object__hash) IndexVector__hash, (Object__equal) IndexVector__equal,
+                (Object__copy) size_t__copy, free
+            );
+        }
+    }
+
+    const double time = Benchmark__now() - begin;
+
+    IndexVector__delete(face);
+    HashMap__delete(map, (Object__delete) IndexVector__delete, free);
+
+    return time;
+}
+
+static double trace__FaceHashMap(
+    const size_t nIndices,
+    const size_t nFaces,
+    const size_t* const faces,
+    size_t* const checksum
+) {
+    FaceHashMap* const map = FaceHashMap__new(nIndices);
+
+    const double begin = Benchmark__now();
+
+    for (size_t iFace = 0 ; iFace < nFaces ; iFace++) {
+        const size_t* const face = &faces[iFace * nIndices];
+
+        size_t value;
+        if (FaceHashMap__get(map, face, &value)) {
+            *checksum += value;
+            FaceHashMap__remove(map, face);
+        } else {
+            FaceHashMap__set(map, face, iFace / (nIndices + 1));
+        }
+    }
+
+    const double time = Benchmark__now() - begin;
+
+    FaceHashMap__delete(map);
+
+    return time;
+}
+
+
+int main(int argc, char** argv) {
+    const size_t nIn     = Benchmark__argument(argc, argv, 1, 2);
+    const size_t nPoints = Benchmark__argument(argc, argv, 2, 100000);
+    const size_t nRepeat = Benchmark__argument(argc, argv, 3, 3);
+    const size_t nOut    = 1;
+
+    double* const table = Benchmark__random_table(nPoints, nIn, nOut, 1);
+
+    ResourceStack resources = ResourceStack__new();
+
+    DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+        resources,
+        DelaunayTable__from_buffer(nPoints, nIn, nOut, table, NULL, Verbosity__quiet, resources),
+        DelaunayTable__delete
+    );
+    const Triangulation* const triangulation = delaunayTable->triangulation;
+
+    // Trace: faces of each polygon, the face opposite to vertices[iEx] in order
+    const size_t nIndices = nVerticesInFace(nIn);
+    const size_t nFaces   = triangulation->nPolygons * nVerticesInPolygon(nIn);
+
+    size_t* const faces = (size_t*) malloc(nFaces * nIndices * sizeof(size_t));
+    for (size_t iPolygon = 0 ; iPolygon < (triangulation->nPolygons) ; iPolygon++) {
+        const size_t* const vertices = Triangulation__vertices(triangulation, iPolygon);
+        for (size_t iEx = 0 ; iEx < nVerticesInPolygon(nIn) ; iEx++) {
+            size_t* const face = &faces[(iPolygon * nVerticesInPolygon(nIn) + iEx) * nIndices];
+            for (size_t i = 0 ; i < nIndices ; i++) {
+                face[i] = vertices[(i < iEx) ? i : i+1];
+            }
+        }
+    }
+
+    printf("# nIn = %zu, nPoints = %zu, nFaces = %zu\n", nIn, nPoints, nFaces);
+    printf("%12s %12s %12s\n", "map", "time [s]", "checksum");
+
+    for (size_t iRepeat = 0 ; iRepeat < nRepeat ; iRepeat++) {
+        size_t checksum = 0;
+        const double time = trace__HashMap(nIndices, nFaces, faces, &checksum);
+        printf("%12s %12.4f %12zu\n", "HashMap", time, checksum);
+    }
+
+    for (size_t iRepeat = 0 ; iRepeat < nRepeat ; iRepeat++) {
+        size_t checksum = 0;
+        const double time = trace__FaceHashMap(nIndices, nFaces, faces, &checksum);
+        printf("%12s %12.4f %12zu\n", "FaceHashMap", time, checksum);
+    }
+
+    free(faces);
+    ResourceStack__delete(resources);
+    free(table);
+    return EXIT_SUCCESS;
+}
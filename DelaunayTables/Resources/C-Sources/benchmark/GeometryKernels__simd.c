@@ -0,0 +1,72 @@
+/**
+ * Benchmark of geometry kernels over `nDim` and instruction sets,
+ * throughput of `divisionRatio` and `insideCircumsphere` per instruction set
+ * supported by the running CPU.
+ *
+ * usage: benchmarkGeometryKernels__simd [maxDim [nCalls]]
+ */
+#include "DelaunayTable.Geometry.h"
+
+#include "Benchmark.h"
+
+
+#define maxPolygons (64)
+
+static const char* const instructionSetNames[] = {"", "scalar", "avx2", "avx512"};
+
+int main(int argc, char** argv) {
+    const size_t maxDim = Benchmark__argument(argc, argv, 1, 6);
+    const size_t nCalls = Benchmark__argument(argc, argv, 2, 1000000);
+
+    const enum InstructionSet supported = InstructionSet__detect();
+
+    printf("# nCalls = %zu, detected = %s, throughput [Mcalls/s]\n", nCalls, instructionSetNames[supported]);
+    printf("%5s %8s %16s %16s\n", "nDim", "isa", "ratio", "sphere");
+
+    for (size_t nDim = 2 ; nDim <= maxDim ; nDim++) {
+        // Random polygons and points, one point per polygon
+        double* const coordinates = Benchmark__random_table(maxPolygons * (nDim+2), nDim, 0, nDim);
+
+        const double* polygons[maxPolygons][64];
+        for (size_t iPolygon = 0 ; iPolygon < maxPolygons ; iPolygon++)
+        for (size_t i = 0 ; i < (nDim+2) ; i++) {
+            polygons[iPolygon][i] = &coordinates[(iPolygon * (nDim+2) + i) * nDim];
+        }
+
+        for (enum InstructionSet instructionSet = InstructionSet__scalar ; instructionSet <= supported ; instructionSet++) {
+            const GeometryKernels kernels = GeometryKernels__select_instructionSet(nDim, instructionSet);
+
+            double ratio[64];
+            bool inside;
+            double checksum = 0.0;
+
+            double throughputs[2];
+            for (size_t iCase = 0 ; iCase < 2 ; iCase++) {
+                const double begin = Benchmark__now();
+
+                for (size_t iCall = 0 ; iCall < nCalls ; iCall++) {
+                    const double* const* const polygon = polygons[iCall % maxPolygons];
+                    const double*        const point   = polygon[nDim+1];
+
+                    if (iCase == 0) {
+                        kernels.divisionRatio(nDim, polygon, point, ratio);
+                        checksum += ratio[0];
+                    } else {
+                        kernels.insideCircumsphere(nDim, polygon, point, &inside);
+                        checksum += inside;
+                    }
+                }
+
+                throughputs[iCase] = 1.0e-6 * (double) nCalls / (Benchmark__now() - begin);
+            }
+
+            printf("%5zu %8s %16.2f %16.2f\n", nDim, instructionSetNames[instructionSet], throughputs[0], throughputs[1]);
+
+            (void) checksum;
+        }
+
+        free(coordinates);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,66 @@
+/**
+ * Benchmark of geometry functions over `nDim`,
+ * generic functions (LAPACK) and kernels selected by `GeometryKernels__select`.
+ *
+ * usage: benchmarkGeometryKernels__solve [maxDim [nCalls]]
+ */
+#include "DelaunayTable.Geometry.h"
+
+#include "Benchmark.h"
+
+
+#define maxPolygons (64)
+
+int main(int argc, char** argv) {
+    const size_t maxDim = Benchmark__argument(argc, argv, 1, 8);
+    const size_t nCalls = Benchmark__argument(argc, argv, 2, 200000);
+
+    printf("# nCalls = %zu, time per call [ns]\n", nCalls);
+    printf("%5s %16s %16s %16s %16s\n",
+        "nDim", "ratio generic", "ratio kernel", "sphere generic", "sphere kernel"
+    );
+
+    for (size_t nDim = 1 ; nDim <= maxDim ; nDim++) {
+        const GeometryKernels kernels = GeometryKernels__select(nDim);
+
+        // Random polygons and points, one point per polygon
+        double* const coordinates = Benchmark__random_table(maxPolygons * (nDim+2), nDim, 0, nDim);
+
+        const double* polygons[maxPolygons][64];
+        for (size_t iPolygon = 0 ; iPolygon < maxPolygons ; iPolygon++)
+        for (size_t i = 0 ; i < (nDim+2) ; i++) {
+            polygons[iPolygon][i] = &coordinates[(iPolygon * (nDim+2) + i) * nDim];
+        }
+
+        double ratio[64];
+        bool inside;
+        size_t nInside = 0;
+
+        double times[4];
+        for (size_t iCase = 0 ; iCase < 4 ; iCase++) {
+            const double begin = Benchmark__now();
+
+            for (size_t iCall = 0 ; iCall < nCalls ; iCall++) {
+                const double* const* const polygon = polygons[iCall % maxPolygons];
+                const double*        const point   = polygon[nDim+1];
+
+                switch (iCase) {
+                case 0: divisionRatioFromPolygonVertices  (nDim, polygon, point, ratio  ); break;
+                case 1: kernels.divisionRatio             (nDim, polygon, point, ratio  ); break;
+                case 2: insideCircumsphereOfPolygon       (nDim, polygon, point, &inside); break;
+                case 3: kernels.insideCircumsphere        (nDim, polygon, point, &inside); break;
+                }
+                nInside += (iCase >= 2 && inside);
+            }
+
+            times[iCase] = 1.0e9 * (Benchmark__now() - begin) / (double) nCalls;
+        }
+
+        printf("%5zu %16.1f %16.1f %16.1f %16.1f\n", nDim, times[0], times[1], times[2], times[3]);
+
+        (void) nInside;
+        free(coordinates);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,69 @@
+/**
+ * Benchmark of `DelaunayTable__from_buffer` over `options.inserter` and `nIn`.
+ * `Inserter__flip` is rejected for `nIn` >= 3 (only 2-to-n flips are implemented),
+ * it is reported as n/a there and `Inserter__cavity` is measured alone.
+ * The number of polygons grows about fivefold per dimension,
+ * the 7D table of the default 1000 points has about 3.5 million polygons.
+ *
+ * usage: benchmarkInserter__dimensions [maxIn [nPoints]]
+ */
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include "Benchmark.h"
+
+
+static double measure(
+    const size_t nPoints,
+    const size_t nIn,
+    const size_t nOut,
+    const double* const table,
+    const enum Inserter inserter,
+    size_t* const nPolygons
+) {
+    DelaunayTableOptions options = DelaunayTableOptions__default();
+    options.inserter = inserter;
+
+    ResourceStack resources = ResourceStack__new();
+
+    const double begin = Benchmark__now();
+    DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+        resources,
+        DelaunayTable__from_buffer(nPoints, nIn, nOut, table, &options, Verbosity__quiet, resources),
+        DelaunayTable__delete
+    );
+    const double time = Benchmark__now() - begin;
+
+    *nPolygons = delaunayTable->triangulation->nPolygons;
+
+    ResourceStack__delete(resources);
+
+    return time;
+}
+
+int main(int argc, char** argv) {
+    const size_t maxIn   = Benchmark__argument(argc, argv, 1, 7);
+    const size_t nPoints = Benchmark__argument(argc, argv, 2, 1000);
+    const size_t nOut    = 1;
+
+    printf("# nPoints = %zu\n", nPoints);
+    printf("%5s %12s %14s %14s %10s\n", "nIn", "nPolygons", "flip [s]", "cavity [s]", "speedup");
+
+    for (size_t nIn = 1 ; nIn <= maxIn ; nIn++) {
+        double* const table = Benchmark__random_table(nPoints, nIn, nOut, 1);
+
+        size_t nPolygons;
+        const double cavityTime = measure(nPoints, nIn, nOut, table, Inserter__cavity, &nPolygons);
+
+        if (nIn <= 2) {
+            const double flipTime = measure(nPoints, nIn, nOut, table, Inserter__flip, &nPolygons);
+            printf("%5zu %12zu %14.4f %14.4f %10.2f\n", nIn, nPolygons, flipTime, cavityTime, flipTime / cavityTime);
+        } else {
+            printf("%5zu %12zu %14s %14.4f %10s\n", nIn, nPolygons, "n/a", cavityTime, "n/a");
+        }
+
+        free(table);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,65 @@
+/**
+ * Build time of `DelaunayTable__from_buffer` for a table sorted along axes,
+ * compared over `options.insertionOrder`.
+ *
+ * usage: benchmarkInsertionOrder__sorted [nIn [nGrid]]
+ */
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include "Benchmark.h"
+
+
+int main(int argc, char** argv) {
+    const size_t nIn   = Benchmark__argument(argc, argv, 1, 2);
+    const size_t nGrid = Benchmark__argument(argc, argv, 2, 100);
+    const size_t nOut  = 1;
+
+    size_t nPoints = 1;
+    for (size_t i = 0 ; i < nIn ; i++) {nPoints *= nGrid;}
+
+    // Slightly jittered grid, sorted along the last axis first
+    double* const table = Benchmark__random_table(nPoints, nIn, nOut, 1);
+    for (size_t iPoint = 0 ; iPoint < nPoints ; iPoint++) {
+        double* const row = &table[iPoint * (nIn + nOut)];
+        size_t index = iPoint;
+        for (size_t i = nIn ; i > 0 ; i--) {
+            row[i-1] = (double) (index % nGrid) + 0.01 * row[i-1];
+            index /= nGrid;
+        }
+    }
+
+    const enum InsertionOrder insertionOrders[] = {
+        InsertionOrder__raw,
+        InsertionOrder__brio
+    };
+    const char* const names[] = {
+        "raw",
+        "brio"
+    };
+
+    printf("# nIn = %zu, nPoints = %zu\n", nIn, nPoints);
+    printf("%10s %12s %12s\n", "order", "time [s]", "polygons");
+
+    for (size_t iCase = 0 ; iCase < 2 ; iCase++) {
+        DelaunayTableOptions options = DelaunayTableOptions__default();
+        options.insertionOrder = insertionOrders[iCase];
+
+        ResourceStack resources = ResourceStack__new();
+
+        const double begin = Benchmark__now();
+        DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+            resources,
+            DelaunayTable__from_buffer(nPoints, nIn, nOut, table, &options, Verbosity__quiet, resources),
+            DelaunayTable__delete
+        );
+        const double time = Benchmark__now() - begin;
+
+        printf("%10s %12.4f %12zu\n", names[iCase], time, delaunayTable->triangulation->nPolygons);
+
+        ResourceStack__delete(resources);
+    }
+
+    free(table);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,61 @@
+/**
+ * Benchmark of `DelaunayTable__get_values` against `DelaunayTable__get_value` one by one
+ * over `nIn`, for random inputs in the convex hull of a random table.
+ *
+ * usage: benchmarkQuery__batch [maxIn [nPoints [nValues]]]
+ */
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include "Benchmark.h"
+
+
+int main(int argc, char** argv) {
+    const size_t maxIn   = Benchmark__argument(argc, argv, 1, 4);
+    const size_t nPoints = Benchmark__argument(argc, argv, 2, 5000);
+    const size_t nValues = Benchmark__argument(argc, argv, 3, 200000);
+    const size_t nOut    = 1;
+
+    printf("# nPoints = %zu, nValues = %zu, time per value [ns]\n", nPoints, nValues);
+    printf("%5s %12s %12s %10s\n", "nIn", "get_value", "get_values", "speedup");
+
+    for (size_t nIn = 1 ; nIn <= maxIn ; nIn++) {
+        double* const table = Benchmark__random_table(nPoints, nIn, nOut, 1);
+        double* const u     = Benchmark__random_table(nValues, nIn, 0   , 2);
+        double* const y     = (double*) malloc(nValues * nOut * sizeof(double));
+        int*    const statuses = (int*) malloc(nValues * sizeof(int));
+        if (!y || !statuses) {return EXIT_FAILURE;}
+
+        for (size_t i = 0 ; i < nValues * nIn ; i++) {
+            u[i] *= 0.9;
+        }
+
+        ResourceStack resources = ResourceStack__new();
+
+        DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+            resources,
+            DelaunayTable__from_buffer(nPoints, nIn, nOut, table, NULL, Verbosity__quiet, resources),
+            DelaunayTable__delete
+        );
+
+        double begin = Benchmark__now();
+        for (size_t iValue = 0 ; iValue < nValues ; iValue++) {
+            statuses[iValue] = DelaunayTable__get_value(delaunayTable, nIn, nOut, &u[iValue * nIn], &y[iValue * nOut]);
+        }
+        const double singleTime = 1.0e9 * (Benchmark__now() - begin) / (double) nValues;
+
+        begin = Benchmark__now();
+        DelaunayTable__get_values(delaunayTable, nIn, nOut, nValues, u, y, statuses);
+        const double batchTime = 1.0e9 * (Benchmark__now() - begin) / (double) nValues;
+
+        printf("%5zu %12.1f %12.1f %10.2f\n", nIn, singleTime, batchTime, singleTime / batchTime);
+
+        ResourceStack__delete(resources);
+        free(table);
+        free(u);
+        free(y);
+        free(statuses);
+    }
+
+    return EXIT_SUCCESS;
+}
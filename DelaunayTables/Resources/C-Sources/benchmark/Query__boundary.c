@@ -0,0 +1,119 @@
+/**
+ * Time of queries on the convex hull of a table against those inside, over `nIn`.
+ * The table has points at the corners and on the faces of [-1, +1]^nIn
+ * (as dense as inside), so inputs with a coordinate of -1 or +1 are on facets of the hull.
+ * Walks start from the grid (`QueryIndex__grid`) to compare the cost of the last polygon.
+ *
+ * usage: benchmarkQuery__boundary [maxIn [nPoints [nQueries]]]
+ */
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include "Benchmark.h"
+
+
+static size_t power__size_t(
+    const size_t base,
+    const size_t exponent
+) {
+    size_t result = 1;
+    for (size_t i = 0 ; i < exponent ; i++) {
+        result *= base;
+    }
+    return result;
+}
+
+/// Mean time [ns] of queries at `u`
+static double measure(
+    DelaunayTable* const delaunayTable,
+    const size_t nIn,
+    const size_t nQueries,
+    const double* const u
+) {
+    QueryWorkspace* const workspace = QueryWorkspace__new(nIn);
+    if (!workspace) {exit(EXIT_FAILURE);}
+
+    size_t nFailed = 0;
+
+    const double begin = Benchmark__now();
+    for (size_t iQuery = 0 ; iQuery < nQueries ; iQuery++) {
+        size_t hint = noPolygon;
+        double y;
+        if (DelaunayTable__get_value_in_workspace(delaunayTable, nIn, 1, &u[iQuery * nIn], &y, &hint, workspace)) {
+            nFailed++;
+        }
+    }
+    const double time = 1.0e9 * (Benchmark__now() - begin) / (double) nQueries;
+
+    if (nFailed > 0) {
+        fprintf(stderr, "# nIn = %zu: %zu of %zu queries failed\n", nIn, nFailed, nQueries);
+    }
+
+    QueryWorkspace__delete(workspace);
+
+    return time;
+}
+
+int main(int argc, char** argv) {
+    const size_t maxIn    = Benchmark__argument(argc, argv, 1, 4);
+    const size_t nPoints  = Benchmark__argument(argc, argv, 2, 5000);
+    const size_t nQueries = Benchmark__argument(argc, argv, 3, 100000);
+    const size_t nOut     = 1;
+
+    printf("# nPoints = %zu, nQueries = %zu, time per query [ns]\n", nPoints, nQueries);
+    printf("%5s %10s %10s %10s\n", "nIn", "interior", "boundary", "ratio");
+
+    for (size_t nIn = 1 ; nIn <= maxIn ; nIn++) {
+        double* const table    = Benchmark__random_table(nPoints , nIn, nOut, 1);
+        double* const interior = Benchmark__random_table(nQueries, nIn, 0   , 2);
+        double* const boundary = Benchmark__random_table(nQueries, nIn, 0   , 3);
+
+        // Corners, then points on faces of the box
+        const size_t nCorners = (size_t) 1 << nIn;
+        size_t nPerAxis = 1;  // about nPoints^(1/nIn)
+        while (power__size_t(nPerAxis + 1, nIn) <= nPoints) {nPerAxis++;}
+        const size_t nOnFaces = nCorners + 2 * nIn * power__size_t(nPerAxis, nIn - 1);
+        for (size_t iPoint = 0 ; iPoint < nOnFaces && iPoint < nPoints ; iPoint++) {
+            double* const row = &table[iPoint * (nIn + nOut)];
+            if (iPoint < nCorners) {
+                for (size_t i = 0 ; i < nIn ; i++) {
+                    row[i] = ((iPoint >> i) & 1) ? +1.0 : -1.0;
+                }
+            } else if (nIn > 1) {  // faces of 1D are corners
+                row[iPoint % nIn] = (row[iPoint % nIn] < 0.0) ? -1.0 : +1.0;
+            }
+        }
+
+        for (size_t iQuery = 0 ; iQuery < nQueries ; iQuery++) {
+            for (size_t i = 0 ; i < nIn ; i++) {
+                interior[iQuery * nIn + i] *= 0.9;
+                boundary[iQuery * nIn + i] *= 0.9;
+            }
+            double* const u = &boundary[iQuery * nIn + iQuery % nIn];
+            *u = (*u < 0.0) ? -1.0 : +1.0;
+        }
+
+        ResourceStack resources = ResourceStack__new();
+
+        DelaunayTableOptions options = DelaunayTableOptions__default();
+        options.queryIndex = QueryIndex__grid;
+
+        DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+            resources,
+            DelaunayTable__from_buffer(nPoints, nIn, nOut, table, &options, Verbosity__quiet, resources),
+            DelaunayTable__delete
+        );
+
+        const double interiorTime = measure(delaunayTable, nIn, nQueries, interior);
+        const double boundaryTime = measure(delaunayTable, nIn, nQueries, boundary);
+
+        printf("%5zu %10.1f %10.1f %10.2f\n", nIn, interiorTime, boundaryTime, boundaryTime / interiorTime);
+
+        ResourceStack__delete(resources);
+        free(table);
+        free(interior);
+        free(boundary);
+    }
+
+    return EXIT_SUCCESS;
+}
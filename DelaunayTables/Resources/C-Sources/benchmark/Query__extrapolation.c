@@ -0,0 +1,92 @@
+/**
+ * Time of queries out of the convex hull of a random table with `Extrapolation__linear`
+ * against those inside, over `nIn`.
+ * Outside inputs are in [-2, +2)^nIn with a coordinate beyond the table.
+ *
+ * usage: benchmarkQuery__extrapolation [maxIn [nPoints [nQueries]]]
+ */
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include "Benchmark.h"
+
+
+/// Mean time [ns] of queries at `u`
+static double measure(
+    DelaunayTable* const delaunayTable,
+    const size_t nIn,
+    const size_t nQueries,
+    const double* const u
+) {
+    QueryWorkspace* const workspace = QueryWorkspace__new(nIn);
+    if (!workspace) {exit(EXIT_FAILURE);}
+
+    size_t nFailed = 0;
+
+    const double begin = Benchmark__now();
+    for (size_t iQuery = 0 ; iQuery < nQueries ; iQuery++) {
+        size_t hint = noPolygon;
+        double y;
+        if (DelaunayTable__get_value_in_workspace(delaunayTable, nIn, 1, &u[iQuery * nIn], &y, &hint, workspace)) {
+            nFailed++;
+        }
+    }
+    const double time = 1.0e9 * (Benchmark__now() - begin) / (double) nQueries;
+
+    if (nFailed > 0) {
+        fprintf(stderr, "# nIn = %zu: %zu of %zu queries failed\n", nIn, nFailed, nQueries);
+    }
+
+    QueryWorkspace__delete(workspace);
+
+    return time;
+}
+
+int main(int argc, char** argv) {
+    const size_t maxIn    = Benchmark__argument(argc, argv, 1, 4);
+    const size_t nPoints  = Benchmark__argument(argc, argv, 2, 5000);
+    const size_t nQueries = Benchmark__argument(argc, argv, 3, 100000);
+    const size_t nOut     = 1;
+
+    printf("# nPoints = %zu, nQueries = %zu, time per query [ns]\n", nPoints, nQueries);
+    printf("%5s %10s %10s %10s\n", "nIn", "interior", "outside", "ratio");
+
+    for (size_t nIn = 1 ; nIn <= maxIn ; nIn++) {
+        double* const table    = Benchmark__random_table(nPoints , nIn, nOut, 1);
+        double* const interior = Benchmark__random_table(nQueries, nIn, 0   , 2);
+        double* const outside  = Benchmark__random_table(nQueries, nIn, 0   , 3);
+
+        for (size_t iQuery = 0 ; iQuery < nQueries ; iQuery++) {
+            for (size_t i = 0 ; i < nIn ; i++) {
+                interior[iQuery * nIn + i] *= 0.9;
+                outside [iQuery * nIn + i] *= 2.0;
+            }
+            double* const u = &outside[iQuery * nIn + iQuery % nIn];
+            *u = (*u < 0.0) ? (*u - 1.0) : (*u + 1.0);
+        }
+
+        ResourceStack resources = ResourceStack__new();
+
+        DelaunayTableOptions options = DelaunayTableOptions__default();
+        options.queryIndex    = QueryIndex__grid;
+        options.extrapolation = Extrapolation__linear;
+
+        DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+            resources,
+            DelaunayTable__from_buffer(nPoints, nIn, nOut, table, &options, Verbosity__quiet, resources),
+            DelaunayTable__delete
+        );
+
+        const double interiorTime = measure(delaunayTable, nIn, nQueries, interior);
+        const double outsideTime  = measure(delaunayTable, nIn, nQueries, outside);
+
+        printf("%5zu %10.1f %10.1f %10.2f\n", nIn, interiorTime, outsideTime, outsideTime / interiorTime);
+
+        ResourceStack__delete(resources);
+        free(table);
+        free(interior);
+        free(outside);
+    }
+
+    return EXIT_SUCCESS;
+}
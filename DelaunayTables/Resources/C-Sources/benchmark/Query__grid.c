@@ -0,0 +1,106 @@
+/**
+ * Latencies of `DelaunayTable__get_value` with `QueryIndex__jump` and `QueryIndex__grid` over `nIn`,
+ * for random inputs in the convex hull of a random table (mean, 99th percentile and maximum).
+ *
+ * usage: benchmarkQuery__grid [maxIn [nPoints [nQueries]]]
+ */
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include "Benchmark.h"
+
+
+static int compare_double(
+    const void* const a,
+    const void* const b
+) {
+    const double da = *(const double*) a;
+    const double db = *(const double*) b;
+    return (da > db) - (da < db);
+}
+
+/// Query latencies [ns] of all inputs
+static void measure(
+    DelaunayTable* const delaunayTable,
+    const size_t nIn,
+    const size_t nQueries,
+    const double* const u,
+    double* const latencies
+) {
+    QueryWorkspace* const workspace = QueryWorkspace__new(nIn);
+    if (!workspace) {exit(EXIT_FAILURE);}
+
+    for (size_t iQuery = 0 ; iQuery < nQueries ; iQuery++) {
+        size_t hint = noPolygon;
+        double y;
+
+        const double begin = Benchmark__now();
+        DelaunayTable__get_value_in_workspace(delaunayTable, nIn, 1, &u[iQuery * nIn], &y, &hint, workspace);
+        latencies[iQuery] = 1.0e9 * (Benchmark__now() - begin);
+    }
+
+    QueryWorkspace__delete(workspace);
+
+    qsort(latencies, nQueries, sizeof(double), compare_double);
+}
+
+int main(int argc, char** argv) {
+    const size_t maxIn    = Benchmark__argument(argc, argv, 1, 4);
+    const size_t nPoints  = Benchmark__argument(argc, argv, 2, 5000);
+    const size_t nQueries = Benchmark__argument(argc, argv, 3, 100000);
+    const size_t nOut     = 1;
+
+    printf("# nPoints = %zu, nQueries = %zu, latency [ns]\n", nPoints, nQueries);
+    printf("%5s %10s %10s %10s %10s %10s %10s\n", "nIn", "jump.mean", "jump.p99", "jump.max", "grid.mean", "grid.p99", "grid.max");
+
+    double* const latencies = (double*) malloc(nQueries * sizeof(double));
+    if (!latencies) {return EXIT_FAILURE;}
+
+    for (size_t nIn = 1 ; nIn <= maxIn ; nIn++) {
+        double* const table = Benchmark__random_table(nPoints, nIn, nOut, 1);
+        double* const u     = Benchmark__random_table(nQueries, nIn, 0, 2);
+
+        for (size_t i = 0 ; i < nQueries * nIn ; i++) {
+            u[i] *= 0.9;
+        }
+
+        printf("%5zu", nIn);
+
+        const enum QueryIndex queryIndexes[] = {QueryIndex__jump, QueryIndex__grid};
+        for (size_t iIndex = 0 ; iIndex < 2 ; iIndex++) {
+            ResourceStack resources = ResourceStack__new();
+
+            DelaunayTableOptions options = DelaunayTableOptions__default();
+            options.queryIndex = queryIndexes[iIndex];
+
+            DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+                resources,
+                DelaunayTable__from_buffer(nPoints, nIn, nOut, table, &options, Verbosity__quiet, resources),
+                DelaunayTable__delete
+            );
+
+            measure(delaunayTable, nIn, nQueries, u, latencies);
+
+            double mean = 0.0;
+            for (size_t iQuery = 0 ; iQuery < nQueries ; iQuery++) {
+                mean += latencies[iQuery];
+            }
+            mean /= (double) nQueries;
+
+            printf(
+                " %10.1f %10.1f %10.1f",
+                mean, latencies[(nQueries * 99) / 100], latencies[nQueries - 1]
+            );
+
+            ResourceStack__delete(resources);
+        }
+        printf("\n");
+
+        free(table);
+        free(u);
+    }
+
+    free(latencies);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,90 @@
+/**
+ * Benchmark of `DelaunayTable__get_value_from_hint` (and in a reused `QueryWorkspace`)
+ * against `DelaunayTable__get_value` over `nIn`, for inputs moving slightly between steps like time steps of a simulation.
+ *
+ * usage: benchmarkQuery__hint [maxIn [nPoints [nSteps]]]
+ */
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include "Benchmark.h"
+
+
+int main(int argc, char** argv) {
+    const size_t maxIn   = Benchmark__argument(argc, argv, 1, 4);
+    const size_t nPoints = Benchmark__argument(argc, argv, 2, 5000);
+    const size_t nSteps  = Benchmark__argument(argc, argv, 3, 100000);
+    const size_t nOut    = 1;
+
+    printf("# nPoints = %zu, nSteps = %zu, time per step [ns]\n", nPoints, nSteps);
+    printf("%5s %12s %12s %12s %10s\n", "nIn", "get_value", "from_hint", "in_workspace", "speedup");
+
+    for (size_t nIn = 1 ; nIn <= maxIn ; nIn++) {
+        double* const table = Benchmark__random_table(nPoints, nIn, nOut, 1);
+        double* const u     = (double*) malloc(nSteps * nIn * sizeof(double));
+        if (!u) {return EXIT_FAILURE;}
+
+        // Random walk inside the convex hull, steps are small compared to polygons
+        double* const steps = Benchmark__random_table(nSteps, nIn, 0, 2);
+        for (size_t i = 0 ; i < nIn ; i++) {
+            u[i] = 0.0;
+        }
+        for (size_t iStep = 1 ; iStep < nSteps ; iStep++) {
+            for (size_t i = 0 ; i < nIn ; i++) {
+                double u_i = u[(iStep - 1) * nIn + i] + 1.0e-3 * steps[iStep * nIn + i];
+                if (u_i > +0.8) {u_i = +1.6 - u_i;}
+                if (u_i < -0.8) {u_i = -1.6 - u_i;}
+                u[iStep * nIn + i] = u_i;
+            }
+        }
+        free(steps);
+
+        ResourceStack resources = ResourceStack__new();
+
+        DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+            resources,
+            DelaunayTable__from_buffer(nPoints, nIn, nOut, table, NULL, Verbosity__quiet, resources),
+            DelaunayTable__delete
+        );
+
+        double y;
+
+        double begin = Benchmark__now();
+        for (size_t iStep = 0 ; iStep < nSteps ; iStep++) {
+            DelaunayTable__get_value(delaunayTable, nIn, nOut, &u[iStep * nIn], &y);
+        }
+        const double jumpTime = 1.0e9 * (Benchmark__now() - begin) / (double) nSteps;
+
+        size_t hint = noPolygon;
+
+        begin = Benchmark__now();
+        for (size_t iStep = 0 ; iStep < nSteps ; iStep++) {
+            DelaunayTable__get_value_from_hint(delaunayTable, nIn, nOut, &u[iStep * nIn], &y, &hint);
+        }
+        const double hintTime = 1.0e9 * (Benchmark__now() - begin) / (double) nSteps;
+
+        QueryWorkspace* const workspace = ResourceStack__ensure_delete_finally(
+            resources,
+            QueryWorkspace__new(nIn),
+            QueryWorkspace__delete
+        );
+        hint = noPolygon;
+
+        begin = Benchmark__now();
+        for (size_t iStep = 0 ; iStep < nSteps ; iStep++) {
+            DelaunayTable__get_value_in_workspace(delaunayTable, nIn, nOut, &u[iStep * nIn], &y, &hint, workspace);
+        }
+        const double workspaceTime = 1.0e9 * (Benchmark__now() - begin) / (double) nSteps;
+
+        printf(
+            "%5zu %12.1f %12.1f %12.1f %10.2f\n",
+            nIn, jumpTime, hintTime, workspaceTime, jumpTime / workspaceTime
+        );
+
+        ResourceStack__delete(resources);
+        free(table);
+        free(u);
+    }
+
+    return EXIT_SUCCESS;
+}
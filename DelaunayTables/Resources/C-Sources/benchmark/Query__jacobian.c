@@ -0,0 +1,102 @@
+/**
+ * Time of a jacobian by `DelaunayTable__get_value_and_jacobian`
+ * against forward finite differences (nIn+1 queries), over `nIn`,
+ * for inputs moving slightly between steps like time steps of a simulation.
+ *
+ * usage: benchmarkQuery__jacobian [maxIn [nPoints [nQueries]]]
+ */
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include "Benchmark.h"
+
+
+#define maxOut (4)
+
+int main(int argc, char** argv) {
+    const size_t maxIn    = Benchmark__argument(argc, argv, 1, 4);
+    const size_t nPoints  = Benchmark__argument(argc, argv, 2, 5000);
+    const size_t nQueries = Benchmark__argument(argc, argv, 3, 100000);
+    const size_t nOut     = maxOut;
+
+    const double step = 1.0e-7;
+
+    printf("# nPoints = %zu, nQueries = %zu, nOut = %zu, time per jacobian [ns]\n", nPoints, nQueries, nOut);
+    printf("%5s %10s %10s %10s\n", "nIn", "finite", "analytic", "ratio");
+
+    for (size_t nIn = 1 ; nIn <= maxIn ; nIn++) {
+        double* const table = Benchmark__random_table(nPoints, nIn, nOut, 1);
+        double* const u     = (double*) malloc(nQueries * nIn * sizeof(double));
+        if (!u) {return EXIT_FAILURE;}
+
+        // Random walk inside the convex hull, as time steps of a simulation
+        double* const steps = Benchmark__random_table(nQueries, nIn, 0, 2);
+        for (size_t i = 0 ; i < nIn ; i++) {
+            u[i] = 0.0;
+        }
+        for (size_t iQuery = 1 ; iQuery < nQueries ; iQuery++) {
+            for (size_t i = 0 ; i < nIn ; i++) {
+                double u_i = u[(iQuery - 1) * nIn + i] + 1.0e-3 * steps[iQuery * nIn + i];
+                if (u_i > +0.8) {u_i = +1.6 - u_i;}
+                if (u_i < -0.8) {u_i = -1.6 - u_i;}
+                u[iQuery * nIn + i] = u_i;
+            }
+        }
+        free(steps);
+
+        double* const y     = (double*) malloc(nOut * (nIn + 2) * sizeof(double));
+        double* const dy_du = (double*) malloc(nOut * nIn * sizeof(double));
+        double* const u_fd  = (double*) malloc(nIn * sizeof(double));
+        if (!y || !dy_du || !u_fd) {return EXIT_FAILURE;}
+
+        ResourceStack resources = ResourceStack__new();
+
+        DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+            resources,
+            DelaunayTable__from_buffer(nPoints, nIn, nOut, table, NULL, Verbosity__quiet, resources),
+            DelaunayTable__delete
+        );
+
+        QueryWorkspace* const workspace = ResourceStack__ensure_delete_finally(
+            resources,
+            QueryWorkspace__new(nIn),
+            QueryWorkspace__delete
+        );
+
+        // Both walk from the hint
+        size_t hint = noPolygon;
+
+        double begin = Benchmark__now();
+        for (size_t iQuery = 0 ; iQuery < nQueries ; iQuery++) {
+            const double* const uQuery = &u[iQuery * nIn];
+            DelaunayTable__get_value_in_workspace(delaunayTable, nIn, nOut, uQuery, y, &hint, workspace);
+            for (size_t j = 0 ; j < nIn ; j++) {
+                for (size_t i = 0 ; i < nIn ; i++) {
+                    u_fd[i] = uQuery[i] + ((i == j) ? step : 0.0);
+                }
+                DelaunayTable__get_value_in_workspace(delaunayTable, nIn, nOut, u_fd, y + nOut, &hint, workspace);
+                for (size_t iOut = 0 ; iOut < nOut ; iOut++) {
+                    dy_du[nIn * iOut + j] = (y[nOut + iOut] - y[iOut]) / step;
+                }
+            }
+        }
+        const double finiteTime = 1.0e9 * (Benchmark__now() - begin) / (double) nQueries;
+
+        begin = Benchmark__now();
+        for (size_t iQuery = 0 ; iQuery < nQueries ; iQuery++) {
+            DelaunayTable__get_value_and_jacobian(delaunayTable, nIn, nOut, &u[iQuery * nIn], y, dy_du, &hint, workspace);
+        }
+        const double analyticTime = 1.0e9 * (Benchmark__now() - begin) / (double) nQueries;
+
+        printf("%5zu %10.1f %10.1f %10.2f\n", nIn, finiteTime, analyticTime, analyticTime / finiteTime);
+
+        ResourceStack__delete(resources);
+        free(table);
+        free(u);
+        free(y);
+        free(dy_du);
+        free(u_fd);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,73 @@
+/**
+ * Scaling of `DelaunayTable__get_values_parallel` over the number of threads
+ * (1, 2, 4, ... up to `maxThreads`), for random inputs in the convex hull of a random table.
+ * The number of processors is reported, threads beyond it only measure the overhead of oversubscription.
+ * Not verified: results so far are of a single processor (nProcs = 1),
+ * where only the overhead of the parallel loop is seen (speedup 1.0 - 1.1 up to 8 threads).
+ * Scaling over cores is to be measured on a multi-core host.
+ *
+ * usage: benchmarkQuery__parallel [maxThreads [nIn [nPoints [nValues]]]]
+ */
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include "Benchmark.h"
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+
+int main(int argc, char** argv) {
+    const size_t maxThreads = Benchmark__argument(argc, argv, 1, 64);
+    const size_t nIn        = Benchmark__argument(argc, argv, 2, 3);
+    const size_t nPoints    = Benchmark__argument(argc, argv, 3, 5000);
+    const size_t nValues    = Benchmark__argument(argc, argv, 4, 200000);
+    const size_t nOut       = 1;
+
+    double* const table = Benchmark__random_table(nPoints, nIn, nOut, 1);
+    double* const u     = Benchmark__random_table(nValues, nIn, 0   , 2);
+    double* const y     = (double*) malloc(nValues * nOut * sizeof(double));
+    if (!y) {return EXIT_FAILURE;}
+
+    for (size_t i = 0 ; i < nValues * nIn ; i++) {
+        u[i] *= 0.9;
+    }
+
+    ResourceStack resources = ResourceStack__new();
+
+    DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+        resources,
+        DelaunayTable__from_buffer(nPoints, nIn, nOut, table, NULL, Verbosity__quiet, resources),
+        DelaunayTable__delete
+    );
+
+#if defined(_OPENMP)
+    const int nProcs = omp_get_num_procs();
+#else
+    const int nProcs = 1;  // without OpenMP, `nThreads` is ignored
+#endif
+
+    printf("# nIn = %zu, nPoints = %zu, nValues = %zu, nProcs = %d\n", nIn, nPoints, nValues, nProcs);
+    printf("%8s %14s %10s\n", "nThreads", "time [ns/value]", "speedup");
+
+    // Warm up the table and `y`, otherwise the first measurement pays for them
+    DelaunayTable__get_values_parallel(delaunayTable, nIn, nOut, nValues, u, y, NULL, 1);
+
+    double serialTime = 0.0;
+    for (size_t nThreads = 1 ; nThreads <= maxThreads ; nThreads *= 2) {
+        const double begin = Benchmark__now();
+        DelaunayTable__get_values_parallel(delaunayTable, nIn, nOut, nValues, u, y, NULL, nThreads);
+        const double time = 1.0e9 * (Benchmark__now() - begin) / (double) nValues;
+
+        if (nThreads == 1) {serialTime = time;}
+        printf("%8zu %14.1f %10.2f\n", nThreads, time, serialTime / time);
+    }
+
+    ResourceStack__delete(resources);
+    free(table);
+    free(u);
+    free(y);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,84 @@
+/**
+ * Benchmark of `DelaunayTable__get_value` over `nIn` and `options.query`,
+ * memory of precomputed transforms against the latency of queries.
+ *
+ * usage: benchmarkQuery__precomputed [maxIn [nPoints [nQueries]]]
+ */
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include "Benchmark.h"
+
+
+int main(int argc, char** argv) {
+    const size_t maxIn    = Benchmark__argument(argc, argv, 1, 4);
+    const size_t nPoints  = Benchmark__argument(argc, argv, 2, 5000);
+    const size_t nQueries = Benchmark__argument(argc, argv, 3, 100000);
+    const size_t nOut     = 1;
+
+    printf("# nPoints = %zu, nQueries = %zu\n", nPoints, nQueries);
+    printf("%5s %10s %12s %16s %15s %12s %14s\n",
+        "nIn", "nPolygons", "tables [MB]", "transforms [MB]",
+        "precompute [s]", "solve [ns]", "precomp. [ns]"
+    );
+
+    for (size_t nIn = 1 ; nIn <= maxIn ; nIn++) {
+        double* const table   = Benchmark__random_table(nPoints , nIn, nOut, 1);
+        double* const queries = Benchmark__random_table(nQueries, nIn, 0   , 2);
+
+        // Queries inside the convex hull of table
+        for (size_t i = 0 ; i < nQueries * nIn ; i++) {
+            queries[i] *= 0.9;
+        }
+
+        const enum Query queries__mode[2] = {Query__solve, Query__precomputed};
+
+        double buildTimes[2];
+        double queryTimes[2];
+        size_t nPolygons = 0;
+
+        for (size_t iCase = 0 ; iCase < 2 ; iCase++) {
+            DelaunayTableOptions options = DelaunayTableOptions__default();
+            options.query = queries__mode[iCase];
+
+            ResourceStack resources = ResourceStack__new();
+
+            const double begin = Benchmark__now();
+            DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+                resources,
+                DelaunayTable__from_buffer(nPoints, nIn, nOut, table, &options, Verbosity__quiet, resources),
+                DelaunayTable__delete
+            );
+            buildTimes[iCase] = Benchmark__now() - begin;
+
+            nPolygons = delaunayTable->triangulation->nPolygons;
+
+            double checksum = 0.0;
+            const double queryBegin = Benchmark__now();
+            for (size_t iQuery = 0 ; iQuery < nQueries ; iQuery++) {
+                double y[1];
+                if (DelaunayTable__get_value(delaunayTable, nIn, nOut, &queries[iQuery * nIn], y) == 0) {
+                    checksum += y[0];
+                }
+            }
+            queryTimes[iCase] = 1.0e9 * (Benchmark__now() - queryBegin) / (double) nQueries;
+
+            (void) checksum;
+            ResourceStack__delete(resources);
+        }
+
+        // Vertices and neighbors of triangulation, and transforms
+        const double tablesMB     = 1.0e-6 * (double) (2 * nPolygons * (nIn + 1) * sizeof(size_t));
+        const double transformsMB = 1.0e-6 * (double) (nPolygons * nIn * nIn * sizeof(double));
+
+        printf("%5zu %10zu %12.2f %16.2f %15.4f %12.1f %14.1f\n",
+            nIn, nPolygons, tablesMB, transformsMB,
+            buildTimes[1] - buildTimes[0], queryTimes[0], queryTimes[1]
+        );
+
+        free(table);
+        free(queries);
+    }
+
+    return EXIT_SUCCESS;
+}
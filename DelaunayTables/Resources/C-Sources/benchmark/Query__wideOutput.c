@@ -0,0 +1,84 @@
+/**
+ * Time of `DelaunayTable__get_value_in_workspace` with `OutputLayout__table` and `OutputLayout__packed`
+ * over `nOut`, for inputs moving slightly between steps like time steps of a simulation.
+ *
+ * usage: benchmarkQuery__wideOutput [nIn [nPoints [nSteps]]]
+ */
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include "Benchmark.h"
+
+
+int main(int argc, char** argv) {
+    const size_t nIn     = Benchmark__argument(argc, argv, 1, 3);
+    const size_t nPoints = Benchmark__argument(argc, argv, 2, 5000);
+    const size_t nSteps  = Benchmark__argument(argc, argv, 3, 100000);
+
+    printf("# nIn = %zu, nPoints = %zu, nSteps = %zu, time per step [ns]\n", nIn, nPoints, nSteps);
+    printf("%5s %10s %10s %10s\n", "nOut", "table", "packed", "speedup");
+
+    // Random walk inside the convex hull, steps are small compared to polygons
+    double* const u     = (double*) malloc(nSteps * nIn * sizeof(double));
+    double* const steps = Benchmark__random_table(nSteps, nIn, 0, 2);
+    if (!u) {return EXIT_FAILURE;}
+    for (size_t i = 0 ; i < nIn ; i++) {
+        u[i] = 0.0;
+    }
+    for (size_t iStep = 1 ; iStep < nSteps ; iStep++) {
+        for (size_t i = 0 ; i < nIn ; i++) {
+            double u_i = u[(iStep - 1) * nIn + i] + 1.0e-3 * steps[iStep * nIn + i];
+            if (u_i > +0.8) {u_i = +1.6 - u_i;}
+            if (u_i < -0.8) {u_i = -1.6 - u_i;}
+            u[iStep * nIn + i] = u_i;
+        }
+    }
+    free(steps);
+
+    for (size_t nOut = 1 ; nOut <= 1024 ; nOut *= 4) {
+        double* const table = Benchmark__random_table(nPoints, nIn, nOut, 1);
+        double* const y     = (double*) malloc(nOut * sizeof(double));
+        if (!y) {return EXIT_FAILURE;}
+
+        double times[2];
+
+        const enum OutputLayout outputLayouts[] = {OutputLayout__table, OutputLayout__packed};
+        for (size_t iLayout = 0 ; iLayout < 2 ; iLayout++) {
+            ResourceStack resources = ResourceStack__new();
+
+            DelaunayTableOptions options = DelaunayTableOptions__default();
+            options.outputLayout = outputLayouts[iLayout];
+
+            DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+                resources,
+                DelaunayTable__from_buffer(nPoints, nIn, nOut, table, &options, Verbosity__quiet, resources),
+                DelaunayTable__delete
+            );
+
+            QueryWorkspace* const workspace = ResourceStack__ensure_delete_finally(
+                resources,
+                QueryWorkspace__new(nIn),
+                QueryWorkspace__delete
+            );
+
+            size_t hint = noPolygon;
+
+            const double begin = Benchmark__now();
+            for (size_t iStep = 0 ; iStep < nSteps ; iStep++) {
+                DelaunayTable__get_value_in_workspace(delaunayTable, nIn, nOut, &u[iStep * nIn], y, &hint, workspace);
+            }
+            times[iLayout] = 1.0e9 * (Benchmark__now() - begin) / (double) nSteps;
+
+            ResourceStack__delete(resources);
+        }
+
+        printf("%5zu %10.1f %10.1f %10.2f\n", nOut, times[0], times[1], times[0] / times[1]);
+
+        free(table);
+        free(y);
+    }
+
+    free(u);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,59 @@
+#include "DelaunayTable.Container.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#define N 1024
+
+static const size_t blockSize = 256;
+
+
+static inline size_t objectSize(
+    const size_t i
+) {
+    // Some objects are larger than a block
+    return (i % 97 == 0) ? 3 * blockSize : 1 + (i * 7) % 61;
+}
+
+static void fill_objects(
+    Arena* const arena,
+    unsigned char** const objects
+) {
+    for (size_t i = 0 ; i < N ; i++) {
+        assert( (objects[i] = (unsigned char*) Arena__allocate(arena, objectSize(i))) != NULL );
+        assert( ((uintptr_t) objects[i]) % _Alignof(max_align_t) == 0 );
+
+        memset(objects[i], (int) (i % 251), objectSize(i));
+    }
+
+    // Objects do not overlap
+    for (size_t i = 0 ; i < N ; i++) {
+        for (size_t j = 0 ; j < objectSize(i) ; j++) {
+            assert( objects[i][j] == (unsigned char) (i % 251) );
+        }
+    }
+}
+
+
+int main(int argc, char** argv) {
+
+    Arena* arena;
+    assert( (arena = Arena__new(blockSize)) != NULL );
+
+    unsigned char* objects[N];
+    fill_objects(arena, objects);
+
+    // Blocks are reused after clear
+    unsigned char* const first = objects[0];
+
+    Arena__clear(arena);
+    fill_objects(arena, objects);
+
+    assert( objects[0] == first );
+
+    Arena__delete(arena);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,126 @@
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+
+
+#define nIn        (3)
+#define nTables    (3)
+#define maxOut     (9)
+#define nPoints    (200)
+#define nValues    (1000)
+
+static double inputs [nPoints * nIn];
+static double outputs[nTables][nPoints * maxOut];
+static double tables [nTables][nPoints * (nIn + maxOut)];
+static double u      [nValues * nIn];
+
+/// deterministic pseudo random number in [-1, +1)
+static double random_coordinate(
+    uint64_t* const state
+) {
+    *state = (*state) * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double) ((*state) >> 11) / (double) (1ULL << 52) - 1.0;
+}
+
+int main(int argc, char** argv) {
+    const size_t nOuts[nTables] = {1, 4, 9};
+
+    // Tables of the same inputs and different outputs
+    uint64_t state = 41;
+    for (size_t i = 0 ; i < nPoints * nIn ; i++) {
+        inputs[i] = random_coordinate(&state);
+    }
+    for (size_t iTable = 0 ; iTable < nTables ; iTable++) {
+        const size_t nOut = nOuts[iTable];
+        for (size_t iPoint = 0 ; iPoint < nPoints ; iPoint++) {
+            for (size_t i = 0 ; i < nIn ; i++) {
+                tables[iTable][iPoint * (nIn + nOut) + i] = inputs[iPoint * nIn + i];
+            }
+            for (size_t iOut = 0 ; iOut < nOut ; iOut++) {
+                const double output = random_coordinate(&state);
+                outputs[iTable][iPoint * nOut + iOut]               = output;
+                tables [iTable][iPoint * (nIn + nOut) + nIn + iOut] = output;
+            }
+        }
+    }
+    for (size_t i = 0 ; i < nValues * nIn ; i++) {
+        u[i] = 0.5 * random_coordinate(&state);
+    }
+
+    const enum OutputLayout outputLayouts[] = {OutputLayout__table, OutputLayout__packed};
+    for (size_t iLayout = 0 ; iLayout < 2 ; iLayout++) {
+        ResourceStack resources = ResourceStack__new();
+
+        DelaunayTableOptions options = DelaunayTableOptions__default();
+        options.outputLayout = outputLayouts[iLayout];
+
+        // One triangulation of inputs only, outputs of all tables are attached
+        DelaunayTable* const shared = ResourceStack__ensure_delete_finally(
+            resources,
+            DelaunayTable__from_buffer(nPoints, nIn, 0, inputs, &options, Verbosity__quiet, resources),
+            DelaunayTable__delete
+        );
+        for (size_t iTable = 0 ; iTable < nTables ; iTable++) {
+            size_t iAttached;
+            assert( DelaunayTable__attach_outputs(shared, nOuts[iTable], outputs[iTable], &iAttached) == 0 );
+            assert( iAttached == iTable );
+        }
+        assert( shared->nAttached == nTables );
+
+        DelaunayTable* separate[nTables];
+        for (size_t iTable = 0 ; iTable < nTables ; iTable++) {
+            separate[iTable] = ResourceStack__ensure_delete_finally(
+                resources,
+                DelaunayTable__from_buffer(nPoints, nIn, nOuts[iTable], tables[iTable], &options, Verbosity__quiet, resources),
+                DelaunayTable__delete
+            );
+        }
+
+        QueryWorkspace* const workspace = ResourceStack__ensure_delete_finally(
+            resources,
+            QueryWorkspace__new(nIn),
+            QueryWorkspace__delete
+        );
+
+        // Same values as tables built separately
+        size_t hint = noPolygon;
+        for (size_t iValue = 0 ; iValue < nValues ; iValue++) {
+            double y    [nTables][maxOut];
+            double y_ref[maxOut];
+            double* const ys[nTables] = {y[0], y[1], y[2]};
+
+            assert( DelaunayTable__get_attached_values(shared, nIn, &u[iValue * nIn], ys, &hint, workspace) == 0 );
+            assert( hint < shared->triangulation->nPolygons );
+
+            for (size_t iTable = 0 ; iTable < nTables ; iTable++) {
+                assert( DelaunayTable__get_value(separate[iTable], nIn, nOuts[iTable], &u[iValue * nIn], y_ref) == 0 );
+                for (size_t iOut = 0 ; iOut < nOuts[iTable] ; iOut++) {
+                    assert( double__compare(y[iTable][iOut], y_ref[iOut]) == 0 );
+                }
+
+                // Outputs of one table alone
+                double y_one[maxOut];
+                assert( DelaunayTable__get_attached_value(shared, nIn, iTable, nOuts[iTable], &u[iValue * nIn], y_one, &hint, workspace) == 0 );
+                for (size_t iOut = 0 ; iOut < nOuts[iTable] ; iOut++) {
+                    assert( double__compare(y_one[iOut], y_ref[iOut]) == 0 );
+                }
+            }
+        }
+
+        // Tables with outputs of their own, and mismatched slots are rejected
+        assert( DelaunayTable__attach_outputs(separate[0], nOuts[1], outputs[1], NULL) != 0 );
+        assert( separate[0]->nAttached == 0 );
+        {
+            double y[maxOut];
+            assert( DelaunayTable__get_attached_value(shared, nIn, nTables, 1       , u, y, &hint, workspace) != 0 );
+            assert( DelaunayTable__get_attached_value(shared, nIn, 0      , nOuts[1], u, y, &hint, workspace) != 0 );
+        }
+
+        ResourceStack__delete(resources);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+
+
+#define u2y(u1, u2) ((u1) * 1.0 + (u2) * 2.0)
+
+#define nIn     (2)
+#define nOut    (1)
+#define nPoints (1000)
+
+static const size_t nThreads[] = {2, 3, 8};
+
+static double table[nPoints * (nIn + nOut)];
+
+/// deterministic pseudo random number in [-1, +1)
+static double random_coordinate(
+    uint64_t* const state
+) {
+    *state = (*state) * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double) ((*state) >> 11) / (double) (1ULL << 52) - 1.0;
+}
+
+static void assert_same_polygons(
+    const DelaunayTable* const expected,
+    const DelaunayTable* const actual
+) {
+    const Triangulation* const triangulation_e = expected->triangulation;
+    const Triangulation* const triangulation_a = actual  ->triangulation;
+
+    assert( triangulation_e->nPolygons == triangulation_a->nPolygons );
+
+    for (size_t iPolygon = 0 ; iPolygon < (triangulation_e->nPolygons) ; iPolygon++) {
+        for (size_t i = 0 ; i < nVerticesInPolygon(nIn) ; i++) {
+            assert(
+                Triangulation__vertices(triangulation_e, iPolygon)[i] ==
+                Triangulation__vertices(triangulation_a, iPolygon)[i]
+            );
+            assert(
+                Triangulation__neighbors(triangulation_e, iPolygon)[i] ==
+                Triangulation__neighbors(triangulation_a, iPolygon)[i]
+            );
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    uint64_t state = 1;
+
+    for (size_t iPoint = 0 ; iPoint < nPoints ; iPoint++) {
+        double* const row = &table[iPoint * (nIn + nOut)];
+        row[0] = random_coordinate(&state);
+        row[1] = random_coordinate(&state);
+        row[2] = u2y(row[0], row[1]);
+    }
+
+    ResourceStack resources = ResourceStack__new();
+
+    DelaunayTableOptions options = DelaunayTableOptions__default();
+    options.locator = Locator__history;
+
+    const DelaunayTable* const serial = ResourceStack__ensure_delete_finally(
+        resources,
+        DelaunayTable__from_buffer(nPoints, nIn, nOut, table, &options, Verbosity__quiet, resources),
+        DelaunayTable__delete
+    );
+
+    for (size_t iCase = 0 ; iCase < sizeof(nThreads) / sizeof(size_t) ; iCase++) {
+        options.nThreads = nThreads[iCase];
+
+        DelaunayTable* const parallel = ResourceStack__ensure_delete_finally(
+            resources,
+            DelaunayTable__from_buffer(nPoints, nIn, nOut, table, &options, Verbosity__quiet, resources),
+            DelaunayTable__delete
+        );
+
+        assert_same_polygons(serial, parallel);
+
+        for (size_t iPoint = 0 ; iPoint < nPoints ; iPoint++) {
+            const double* const row = &table[iPoint * (nIn + nOut)];
+            double y[nOut];
+
+            assert( DelaunayTable__get_value(parallel, nIn, nOut, row, y) == 0 );
+            assert( double__compare(y[0], row[2]) == 0 );
+        }
+    }
+
+    ResourceStack__delete(resources);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,35 @@
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include <stddef.h>
+
+
+#define nIn     (2)
+#define nOut    (1)
+#define nPoints (4)
+
+static const double table[nPoints * (nIn + nOut)] = {
+    0.0, 0.0, 0.0,
+    1.0, 0.0, 1.0,
+    0.0, 1.0, 1.0,
+    1.0, 1.0, 2.0
+};
+
+/// `nThreads` > 1 with `Locator__walk` is an error (expected to fail)
+int main(int argc, char** argv) {
+    DelaunayTableOptions options = DelaunayTableOptions__default();
+    options.nThreads = 2;
+    options.locator  = Locator__walk;
+
+    ResourceStack resources = ResourceStack__new();
+
+    ResourceStack__ensure_delete_finally(
+        resources,
+        DelaunayTable__from_buffer(nPoints, nIn, nOut, table, &options, Verbosity__quiet, resources),
+        DelaunayTable__delete
+    );
+
+    ResourceStack__delete(resources);
+
+    return EXIT_SUCCESS;
+}
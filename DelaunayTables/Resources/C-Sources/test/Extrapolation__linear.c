@@ -0,0 +1,118 @@
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+
+
+#define nOut       (1)
+#define maxIn      (4)
+#define maxPoints  (300)
+#define nValues    (2000)
+
+static double table[maxPoints * (maxIn + nOut)];
+static double u    [nValues * maxIn];
+
+/// deterministic pseudo random number in [-1, +1)
+static double random_coordinate(
+    uint64_t* const state
+) {
+    *state = (*state) * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double) ((*state) >> 11) / (double) (1ULL << 52) - 1.0;
+}
+
+/// Output of the table, linear extension of a linear function is exact
+static double linear(
+    const size_t nIn,
+    const double* const coordinates
+) {
+    double y = -0.25;
+    for (size_t i = 0 ; i < nIn ; i++) {
+        y += (double) (2 * i + 1) * coordinates[i];
+    }
+    return y;
+}
+
+static DelaunayTable* from_table(
+    const size_t nIn,
+    const size_t nPoints,
+    const enum Extrapolation extrapolation,
+    ResourceStack resources
+) {
+    DelaunayTableOptions options = DelaunayTableOptions__default();
+    options.extrapolation = extrapolation;
+
+    return ResourceStack__ensure_delete_finally(
+        resources,
+        DelaunayTable__from_buffer(nPoints, nIn, nOut, table, &options, Verbosity__quiet, resources),
+        DelaunayTable__delete
+    );
+}
+
+int main(int argc, char** argv) {
+    const size_t nIns    [] = {1 , 2  , 3  , 4  };
+    const size_t nPointss[] = {50, 300, 200, 100};
+
+    for (size_t iCase = 0 ; iCase < 4 ; iCase++) {
+        const size_t nIn     = nIns    [iCase];
+        const size_t nPoints = nPointss[iCase];
+
+        uint64_t state = 29;
+        for (size_t iPoint = 0 ; iPoint < nPoints ; iPoint++) {
+            double* const row = &table[iPoint * (nIn + nOut)];
+            for (size_t i = 0 ; i < nIn ; i++) {
+                row[i] = random_coordinate(&state);
+            }
+            row[nIn] = linear(nIn, row);
+        }
+
+        // Most of inputs are outside of the convex hull
+        for (size_t i = 0 ; i < nValues * nIn ; i++) {
+            u[i] = 3.0 * random_coordinate(&state);
+        }
+
+        ResourceStack resources = ResourceStack__new();
+
+        DelaunayTable* const none         = from_table(nIn, nPoints, Extrapolation__none  , resources);
+        DelaunayTable* const extrapolated = from_table(nIn, nPoints, Extrapolation__linear, resources);
+
+        // Polygons out of the hull have boundary polygons on table
+        const Triangulation* const triangulation = extrapolated->triangulation;
+        assert( none->triangulation->hullOffsets == NULL );
+        assert( triangulation->hullOffsets != NULL );
+        for (size_t iPolygon = 0 ; iPolygon < (triangulation->nPolygons) ; iPolygon++) {
+            const size_t begin = triangulation->hullOffsets[iPolygon];
+            const size_t end   = triangulation->hullOffsets[iPolygon + 1];
+            const bool outOfHull = Triangulation__vertices(triangulation, iPolygon)[nIn] >= nPoints;
+
+            assert( outOfHull ? (begin < end) : (begin == end) );
+            for (size_t i = begin ; i < end ; i++) {
+                const size_t hullPolygon = triangulation->hullPolygons[i];
+                assert( Triangulation__vertices(triangulation, hullPolygon)[nIn] < nPoints );
+            }
+        }
+
+        // All inputs are extrapolated exactly, inputs out of the hull fail without extrapolation
+        size_t nFailed = 0;
+        size_t hint = noPolygon;
+        for (size_t iValue = 0 ; iValue < nValues ; iValue++) {
+            double y_none;
+            double y;
+            const int status_none = DelaunayTable__get_value(none, nIn, nOut, &u[iValue * nIn], &y_none);
+            const int status      = DelaunayTable__get_value_from_hint(extrapolated, nIn, nOut, &u[iValue * nIn], &y, &hint);
+
+            assert( status == 0 );
+            assert( double__compare(y, linear(nIn, &u[iValue * nIn])) == 0 );
+
+            if (status_none) {nFailed++; continue;}
+            assert( double__compare(y, y_none) == 0 );
+        }
+        assert( nFailed > 0 && nFailed < nValues );
+
+        ResourceStack__delete(resources);
+    }
+
+    return EXIT_SUCCESS;
+}
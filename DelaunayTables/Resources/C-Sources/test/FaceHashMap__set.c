@@ -0,0 +1,94 @@
+#include "DelaunayTable.FaceHashMap.h"
+
+#include <stdlib.h>
+#include <assert.h>
+
+#define N 4096
+
+/// Faces of sequential indices, which collide easily with weak hashes
+#define nIndices (3)
+
+static void set_face(
+    const size_t i,
+    size_t face[nIndices]
+) {
+    for (size_t j = 0 ; j < nIndices ; j++) {
+        face[j] = i + j;
+    }
+}
+
+static void assert_contents(
+    const FaceHashMap* const map,
+    const bool* const contained
+) {
+    size_t size = 0;
+
+    for (size_t i = 0 ; i < N ; i++) {
+        size_t face[nIndices];
+        set_face(i, face);
+
+        size_t value;
+        if (contained[i]) {
+            assert(  FaceHashMap__get(map, face, &value) );
+            assert(  value == i );
+            size++;
+        } else {
+            assert( !FaceHashMap__get(map, face, &value) );
+        }
+    }
+
+    assert( (map->size) == size );
+}
+
+
+int main(int argc, char** argv) {
+
+    FaceHashMap* map;
+    assert( (map = FaceHashMap__new(nIndices)) != NULL );
+
+    bool contained[N] = {false};
+
+    // Set even faces
+    for (size_t i = 0 ; i < N ; i += 2) {
+        size_t face[nIndices];
+        set_face(i, face);
+
+        assert( FaceHashMap__set(map, face, N) == 0 );
+        assert( FaceHashMap__set(map, face, i) == 0 );  // overwrite
+        contained[i] = true;
+    }
+    assert_contents(map, contained);
+
+    // Remove every 4th face, then set odd faces
+    for (size_t i = 0 ; i < N ; i += 4) {
+        size_t face[nIndices];
+        set_face(i, face);
+
+        assert(  FaceHashMap__remove(map, face) );
+        assert( !FaceHashMap__remove(map, face) );
+        contained[i] = false;
+    }
+    assert_contents(map, contained);
+
+    for (size_t i = 1 ; i < N ; i += 2) {
+        size_t face[nIndices];
+        set_face(i, face);
+
+        assert( FaceHashMap__set(map, face, i) == 0 );
+        contained[i] = true;
+    }
+    assert_contents(map, contained);
+
+    // Capacity is a power of two within the load factor
+    assert( ((map->capacity) & (map->capacity - 1)) == 0 );
+    assert( (map->size) * 8 <= (map->capacity) * 7 );
+
+    FaceHashMap__clear(map);
+
+    for (size_t i = 0 ; i < N ; i++) {contained[i] = false;}
+    assert_contents(map, contained);
+
+    FaceHashMap__delete(map);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,92 @@
+#include "DelaunayTable.Geometry.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+
+
+#define maxDim (6)
+#define nCase  (500)
+
+/// deterministic pseudo random number in [-1, +1)
+static double random_coordinate(
+    uint64_t* const state
+) {
+    *state = (*state) * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double) ((*state) >> 11) / (double) (1ULL << 52) - 1.0;
+}
+
+int main(int argc, char** argv) {
+    const enum InstructionSet supported = InstructionSet__detect();
+
+    // Kernels of all supported instruction sets agree with scalar kernels
+    for (enum InstructionSet instructionSet = InstructionSet__scalar ; instructionSet <= supported ; instructionSet++) {
+        uint64_t state = 11;
+
+        for (size_t nDim = 1 ; nDim <= maxDim ; nDim++) {
+            const GeometryKernels kernels    = GeometryKernels__select_instructionSet(nDim, instructionSet);
+            const GeometryKernels kernelsRef = GeometryKernels__select_instructionSet(nDim, InstructionSet__scalar);
+
+            for (size_t iCase = 0 ; iCase < nCase ; iCase++) {
+                double coordinates[maxDim+1][maxDim];
+                double point[maxDim];
+
+                const double* polygon[maxDim+1];
+                for (size_t i = 0 ; i < (nDim+1) ; i++) {
+                    for (size_t j = 0 ; j < nDim ; j++) {
+                        coordinates[i][j] = random_coordinate(&state);
+                    }
+                    polygon[i] = coordinates[i];
+                }
+                for (size_t j = 0 ; j < nDim ; j++) {
+                    point[j] = random_coordinate(&state);
+                }
+
+                double ratio    [maxDim+1];
+                double ratio_ref[maxDim+1];
+
+                assert( kernels   .divisionRatio(nDim, polygon, point, ratio    ) == 0 );
+                assert( kernelsRef.divisionRatio(nDim, polygon, point, ratio_ref) == 0 );
+
+                for (size_t i = 0 ; i < (nDim+1) ; i++) {
+                    assert( double__abs(ratio[i] - ratio_ref[i]) < 1.0e-6 * (1.0 + double__abs(ratio_ref[i])) );
+                }
+
+                bool inside;
+                bool inside_ref;
+
+                assert( kernels   .insideCircumsphere(nDim, polygon, point, &inside    ) == 0 );
+                assert( kernelsRef.insideCircumsphere(nDim, polygon, point, &inside_ref) == 0 );
+
+                assert( inside == inside_ref );
+
+                double centor     [maxDim], determinant;
+                double centor_ref [maxDim], determinant_ref;
+
+                assert( kernels   .circumcenter(nDim, polygon, centor, &determinant) == 0 );
+                assert( kernelsRef.circumcenter(nDim, polygon, centor_ref, &determinant_ref) == 0 );
+
+                for (size_t i = 0 ; i < nDim ; i++) {
+                    assert( double__abs(centor[i] - centor_ref[i]) < 1.0e-6 * (1.0 + double__abs(centor_ref[i])) );
+                }
+                assert( double__abs(determinant - determinant_ref) < 1.0e-6 * determinant_ref );
+            }
+
+            // Degenerated polygon fails
+            double coordinates[maxDim+1][maxDim] = {{0.0}};
+            const double* polygon[maxDim+1];
+            for (size_t i = 0 ; i < (nDim+1) ; i++) {
+                polygon[i] = coordinates[i];
+            }
+
+            double ratio[maxDim+1];
+            bool inside;
+            assert( kernels.divisionRatio(nDim, polygon, coordinates[0], ratio) != 0 );
+            assert( kernels.insideCircumsphere(nDim, polygon, coordinates[0], &inside) != 0 );
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,159 @@
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+
+#define nOut       (1)
+#define maxIn      (4)
+#define maxPoints  (300)
+
+static double table[maxPoints * (maxIn + nOut)];
+
+/// deterministic pseudo random number in [-1, +1)
+static double random_coordinate(
+    uint64_t* const state
+) {
+    *state = (*state) * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double) ((*state) >> 11) / (double) (1ULL << 52) - 1.0;
+}
+
+static bool contains(
+    const size_t nIn,
+    const size_t* const vertices,
+    const size_t vertex
+) {
+    for (size_t i = 0 ; i < nVerticesInPolygon(nIn) ; i++) {
+        if (vertices[i] == vertex) {return true;}
+    }
+    return false;
+}
+
+static int compare_polygons(
+    const void* const a,
+    const void* const b
+) {
+    const size_t* const polygon_a = (const size_t*) a;
+    const size_t* const polygon_b = (const size_t*) b;
+
+    // Polygons of 2D tables
+    for (size_t i = 0 ; i < nVerticesInPolygon(2) ; i++) {
+        if (polygon_a[i] < polygon_b[i]) {return -1;}
+        if (polygon_a[i] > polygon_b[i]) {return +1;}
+    }
+    return 0;
+}
+
+static void check_delaunay(
+    const size_t nIn,
+    const size_t nPoints,
+    const Triangulation* const triangulation
+) {
+    for (size_t iPolygon = 0 ; iPolygon < (triangulation->nPolygons) ; iPolygon++) {
+        const size_t* const vertices  = Triangulation__vertices (triangulation, iPolygon);
+        const size_t* const neighbors = Triangulation__neighbors(triangulation, iPolygon);
+
+        // Neighbors share faces each other
+        for (size_t iEx = 0 ; iEx < nVerticesInPolygon(nIn) ; iEx++) {
+            if (neighbors[iEx] == noPolygon) {
+                for (size_t i = 0 ; i < nVerticesInPolygon(nIn) ; i++) {
+                    assert( i == iEx || vertices[i] >= nPoints );
+                }
+                continue;
+            }
+
+            const size_t* const neighborVertices  = Triangulation__vertices (triangulation, neighbors[iEx]);
+            const size_t* const neighborNeighbors = Triangulation__neighbors(triangulation, neighbors[iEx]);
+
+            for (size_t i = 0 ; i < nVerticesInPolygon(nIn) ; i++) {
+                if (i == iEx) {continue;}
+                assert( contains(nIn, neighborVertices, vertices[i]) );
+            }
+            assert( !contains(nIn, neighborVertices, vertices[iEx]) );
+            assert( contains(nIn, neighborNeighbors, iPolygon) );
+        }
+
+        // Delaunay: no point of table is inside of the circumsphere
+        bool onTable = true;
+        for (size_t i = 0 ; i < nVerticesInPolygon(nIn) ; i++) {
+            onTable = onTable && (vertices[i] < nPoints);
+        }
+        if (!onTable) {continue;}
+
+        const double* shape[nVerticesInPolygon(maxIn)];
+        for (size_t i = 0 ; i < nVerticesInPolygon(nIn) ; i++) {
+            shape[i] = &table[vertices[i] * (nIn + nOut)];
+        }
+
+        for (size_t iPoint = 0 ; iPoint < nPoints ; iPoint++) {
+            if (contains(nIn, vertices, iPoint)) {continue;}
+
+            bool inside;
+            assert( insideCircumsphereOfPolygon(nIn, shape, &table[iPoint * (nIn + nOut)], &inside) == 0 );
+            assert( !inside );
+        }
+    }
+}
+
+static DelaunayTable* from_table(
+    const size_t nIn,
+    const size_t nPoints,
+    const enum Inserter inserter,
+    ResourceStack resources
+) {
+    DelaunayTableOptions options = DelaunayTableOptions__default();
+    options.inserter = inserter;
+
+    return ResourceStack__ensure_delete_finally(
+        resources,
+        DelaunayTable__from_buffer(nPoints, nIn, nOut, table, &options, Verbosity__quiet, resources),
+        DelaunayTable__delete
+    );
+}
+
+int main(int argc, char** argv) {
+    const size_t nIns    [] = {2  , 3  , 4 };
+    const size_t nPointss[] = {300, 150, 60};
+
+    for (size_t iCase = 0 ; iCase < 3 ; iCase++) {
+        const size_t nIn     = nIns    [iCase];
+        const size_t nPoints = nPointss[iCase];
+
+        uint64_t state = 5;
+        for (size_t i = 0 ; i < nPoints * (nIn + nOut) ; i++) {
+            table[i] = random_coordinate(&state);
+        }
+
+        ResourceStack resources = ResourceStack__new();
+
+        const DelaunayTable* const cavity = from_table(nIn, nPoints, Inserter__cavity, resources);
+
+        check_delaunay(nIn, nPoints, cavity->triangulation);
+
+        // Delaunay division of points in general position is unique
+        if (nIn == 2) {
+            const DelaunayTable* const flip = from_table(nIn, nPoints, Inserter__flip, resources);
+
+            const size_t nPolygons = cavity->triangulation->nPolygons;
+            assert( flip->triangulation->nPolygons == nPolygons );
+
+            qsort(cavity->triangulation->vertices, nPolygons, nVerticesInPolygon(nIn) * sizeof(size_t), compare_polygons);
+            qsort(flip  ->triangulation->vertices, nPolygons, nVerticesInPolygon(nIn) * sizeof(size_t), compare_polygons);
+
+            assert( memcmp(
+                cavity->triangulation->vertices,
+                flip  ->triangulation->vertices,
+                nPolygons * nVerticesInPolygon(nIn) * sizeof(size_t)
+            ) == 0 );
+        }
+
+        ResourceStack__delete(resources);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,125 @@
+#include "DelaunayTable.h"
+#include "DelaunayTable.InsertionOrder.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+
+
+#define u2y(u1, u2) ((u1) * 1.0 + (u2) * 2.0)
+
+#define nIn     (2)
+#define nOut    (1)
+#define nGrid   (24)
+#define nPoints (nGrid * nGrid)
+
+static double table[nPoints * (nIn + nOut)];
+
+static const double* table__get_coordinates(
+    const Points points,
+    const size_t index
+) {
+    return ((const double*) points) + index * (nIn + nOut);
+}
+
+/// Consecutive cells along the hilbert curve must be adjacent
+static void assert_hilbert_curve(
+    const size_t nDim,
+    const size_t nBits
+) {
+    const size_t nCells = ((size_t) 1) << (nDim * nBits);
+
+    size_t*   cells = (size_t*)   malloc(nCells * sizeof(size_t));
+    uint64_t* axes  = (uint64_t*) malloc(nDim   * sizeof(uint64_t));
+    assert( cells && axes );
+
+    for (size_t iCell = 0 ; iCell < nCells ; iCell++) {
+        for (size_t i = 0 ; i < nDim ; i++) {
+            axes[i] = (iCell >> (i * nBits)) & ((((size_t) 1) << nBits) - 1);
+        }
+        const uint64_t index = hilbertIndex(nDim, nBits, axes);
+        assert( index < nCells );
+        cells[index] = iCell;
+    }
+
+    for (size_t index = 1 ; index < nCells ; index++) {
+        size_t distance = 0;
+        for (size_t i = 0 ; i < nDim ; i++) {
+            const size_t a = (cells[index-1] >> (i * nBits)) & ((((size_t) 1) << nBits) - 1);
+            const size_t b = (cells[index  ] >> (i * nBits)) & ((((size_t) 1) << nBits) - 1);
+            distance += (a > b) ? a - b : b - a;
+        }
+        assert( distance == 1 );
+    }
+
+    free(cells);
+    free(axes);
+}
+
+
+int main(int argc, char** argv) {
+    assert_hilbert_curve(2, 4);
+    assert_hilbert_curve(3, 3);
+    assert_hilbert_curve(4, 2);
+
+    // Table sorted along axes
+    for (size_t ix = 0 ; ix < nGrid ; ix++)
+    for (size_t iy = 0 ; iy < nGrid ; iy++) {
+        double* const row = &table[(ix * nGrid + iy) * (nIn + nOut)];
+        row[0] = (double) ix / (double) (nGrid-1);
+        row[1] = (double) iy / (double) (nGrid-1);
+        row[2] = u2y(row[0], row[1]);
+    }
+
+    // `order` is a permutation of points
+    size_t order[nPoints];
+    bool   found[nPoints] = {};
+
+    assert( InsertionOrder__arrange(
+        InsertionOrder__brio, nIn, 0, nPoints,
+        (Points) table, table__get_coordinates, order
+    ) == 0 );
+
+    for (size_t i = 0 ; i < nPoints ; i++) {
+        assert( order[i] < nPoints );
+        assert( !found[order[i]] );
+        found[order[i]] = true;
+    }
+
+    // Interpolation does not depend on the insertion order
+    ResourceStack resources = ResourceStack__new();
+
+    const enum InsertionOrder insertionOrders[] = {
+        InsertionOrder__raw,
+        InsertionOrder__brio
+    };
+
+    for (size_t iCase = 0 ; iCase < 2 ; iCase++) {
+        DelaunayTableOptions options = DelaunayTableOptions__default();
+        options.insertionOrder = insertionOrders[iCase];
+
+        DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+            resources,
+            DelaunayTable__from_buffer(nPoints, nIn, nOut, table, &options, Verbosity__quiet, resources),
+            DelaunayTable__delete
+        );
+
+        for (size_t ix = 0 ; ix < 2*nGrid ; ix++)
+        for (size_t iy = 0 ; iy < 2*nGrid ; iy++) {
+            const double u[nIn] = {
+                (double) ix / (double) (2*nGrid-1),
+                (double) iy / (double) (2*nGrid-1)
+            };
+            double y[nOut];
+
+            assert( DelaunayTable__get_value(delaunayTable, nIn, nOut, u, y) == 0 );
+            assert( double__compare(y[0], u2y(u[0], u[1])) == 0 );
+        }
+    }
+
+    ResourceStack__delete(resources);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,113 @@
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+
+
+#define nOut       (3)
+#define maxIn      (5)
+#define maxPoints  (300)
+#define nValues    (1000)
+
+static double table[maxPoints * (maxIn + nOut)];
+static double u    [nValues * maxIn];
+
+/// deterministic pseudo random number in [-1, +1)
+static double random_coordinate(
+    uint64_t* const state
+) {
+    *state = (*state) * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double) ((*state) >> 11) / (double) (1ULL << 52) - 1.0;
+}
+
+/// Derivative of output `iOut` of the table with respect to input `i`
+static double slope(
+    const size_t iOut,
+    const size_t i
+) {
+    return (double) (iOut + 1) - 0.5 * (double) i;
+}
+
+static DelaunayTable* from_table(
+    const size_t nIn,
+    const size_t nPoints,
+    const enum Query query,
+    ResourceStack resources
+) {
+    DelaunayTableOptions options = DelaunayTableOptions__default();
+    options.query = query;
+
+    return ResourceStack__ensure_delete_finally(
+        resources,
+        DelaunayTable__from_buffer(nPoints, nIn, nOut, table, &options, Verbosity__quiet, resources),
+        DelaunayTable__delete
+    );
+}
+
+int main(int argc, char** argv) {
+    const size_t nIns    [] = {1 , 2  , 3  , 4  , 5  };
+    const size_t nPointss[] = {50, 300, 200, 150, 100};
+
+    for (size_t iCase = 0 ; iCase < 5 ; iCase++) {
+        const size_t nIn     = nIns    [iCase];
+        const size_t nPoints = nPointss[iCase];
+
+        uint64_t state = 31;
+        for (size_t iPoint = 0 ; iPoint < nPoints ; iPoint++) {
+            double* const row = &table[iPoint * (nIn + nOut)];
+            for (size_t i = 0 ; i < nIn ; i++) {
+                row[i] = random_coordinate(&state);
+            }
+            for (size_t iOut = 0 ; iOut < nOut ; iOut++) {
+                row[nIn + iOut] = (double) iOut;
+                for (size_t i = 0 ; i < nIn ; i++) {
+                    row[nIn + iOut] += slope(iOut, i) * row[i];
+                }
+            }
+        }
+
+        // Inputs in the convex hull
+        for (size_t i = 0 ; i < nValues * nIn ; i++) {
+            u[i] = 0.5 * random_coordinate(&state);
+        }
+
+        ResourceStack resources = ResourceStack__new();
+
+        const enum Query queries[] = {Query__solve, Query__precomputed};
+        for (size_t iQuery = 0 ; iQuery < 2 ; iQuery++) {
+            DelaunayTable* const delaunayTable = from_table(nIn, nPoints, queries[iQuery], resources);
+
+            QueryWorkspace* const workspace = ResourceStack__ensure_delete_finally(
+                resources,
+                QueryWorkspace__new(nIn),
+                QueryWorkspace__delete
+            );
+
+            // Values are those of `get_value`, jacobians are the slopes of the table
+            size_t hint = noPolygon;
+            for (size_t iValue = 0 ; iValue < nValues ; iValue++) {
+                double y    [nOut];
+                double y_ref[nOut];
+                double dy_du[nOut * maxIn];
+
+                assert( DelaunayTable__get_value_and_jacobian(
+                    delaunayTable, nIn, nOut, &u[iValue * nIn], y, dy_du, &hint, workspace
+                ) == 0 );
+                assert( DelaunayTable__get_value(delaunayTable, nIn, nOut, &u[iValue * nIn], y_ref) == 0 );
+
+                for (size_t iOut = 0 ; iOut < nOut ; iOut++) {
+                    assert( double__compare(y[iOut], y_ref[iOut]) == 0 );
+                    for (size_t i = 0 ; i < nIn ; i++) {
+                        assert( double__compare(dy_du[nIn * iOut + i], slope(iOut, i)) == 0 );
+                    }
+                }
+            }
+        }
+
+        ResourceStack__delete(resources);
+    }
+
+    return EXIT_SUCCESS;
+}
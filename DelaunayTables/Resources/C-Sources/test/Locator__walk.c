@@ -0,0 +1,84 @@
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+
+
+#define u2y(u1, u2) ((u1) * 1.0 + (u2) * 2.0)
+
+#define nIn     (2)
+#define nOut    (1)
+#define nPoints (2000)
+
+static double table[nPoints * (nIn + nOut)];
+
+/// deterministic pseudo random number in [-1, +1)
+static double random_coordinate(
+    uint64_t* const state
+) {
+    *state = (*state) * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double) ((*state) >> 11) / (double) (1ULL << 52) - 1.0;
+}
+
+int main(int argc, char** argv) {
+    uint64_t state = 1;
+
+    for (size_t iPoint = 0 ; iPoint < nPoints ; iPoint++) {
+        double* const row = &table[iPoint * (nIn + nOut)];
+        row[0] = random_coordinate(&state);
+        row[1] = random_coordinate(&state);
+        row[2] = u2y(row[0], row[1]);
+    }
+
+    ResourceStack resources = ResourceStack__new();
+
+    const enum Locator locators[] = {
+        Locator__history,
+        Locator__walk
+    };
+
+    size_t nPolygons[2];
+
+    for (size_t iCase = 0 ; iCase < 2 ; iCase++) {
+        DelaunayTableOptions options = DelaunayTableOptions__default();
+        options.locator = locators[iCase];
+
+        DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+            resources,
+            DelaunayTable__from_buffer(nPoints, nIn, nOut, table, &options, Verbosity__quiet, resources),
+            DelaunayTable__delete
+        );
+
+        nPolygons[iCase] = delaunayTable->triangulation->nPolygons;
+
+        // Points and midpoints of table are inside the convex hull
+        for (size_t iPoint = 0 ; iPoint < nPoints ; iPoint++) {
+            const double* const row0 = &table[iPoint * (nIn + nOut)];
+            const double* const row1 = &table[((iPoint * 7 + 1) % nPoints) * (nIn + nOut)];
+
+            const double us[2][nIn] = {
+                {row0[0], row0[1]},
+                {0.5 * (row0[0] + row1[0]), 0.5 * (row0[1] + row1[1])}
+            };
+
+            for (size_t iU = 0 ; iU < 2 ; iU++) {
+                double y[nOut];
+                assert( DelaunayTable__get_value(delaunayTable, nIn, nOut, us[iU], y) == 0 );
+                assert( double__compare(y[0], u2y(us[iU][0], us[iU][1])) == 0 );
+            }
+        }
+
+        // Outside of the convex hull
+        const double u[nIn] = {1.5, 0.0};
+        double y[nOut];
+        assert( DelaunayTable__get_value(delaunayTable, nIn, nOut, u, y) != 0 );
+    }
+
+    // Delaunay triangulation of points in general position is unique
+    assert( nPolygons[0] == nPolygons[1] );
+
+    ResourceStack__delete(resources);
+    return EXIT_SUCCESS;
+}
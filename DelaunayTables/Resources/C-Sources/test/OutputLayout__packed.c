@@ -0,0 +1,104 @@
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+
+
+#define nIn        (3)
+#define maxOut     (37)
+#define nPoints    (200)
+#define nValues    (1000)
+
+static double table[nPoints * (nIn + maxOut)];
+static double u    [nValues * nIn];
+
+/// deterministic pseudo random number in [-1, +1)
+static double random_coordinate(
+    uint64_t* const state
+) {
+    *state = (*state) * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double) ((*state) >> 11) / (double) (1ULL << 52) - 1.0;
+}
+
+static DelaunayTable* from_table(
+    const size_t nOut,
+    const enum OutputLayout outputLayout,
+    ResourceStack resources
+) {
+    DelaunayTableOptions options = DelaunayTableOptions__default();
+    options.outputLayout = outputLayout;
+
+    return ResourceStack__ensure_delete_finally(
+        resources,
+        DelaunayTable__from_buffer(nPoints, nIn, nOut, table, &options, Verbosity__quiet, resources),
+        DelaunayTable__delete
+    );
+}
+
+int main(int argc, char** argv) {
+    const size_t nOuts[] = {1, 3, 8, 37};
+
+    for (size_t iCase = 0 ; iCase < 4 ; iCase++) {
+        const size_t nOut = nOuts[iCase];
+
+        uint64_t state = 37;
+        for (size_t i = 0 ; i < nPoints * (nIn + nOut) ; i++) {
+            table[i] = random_coordinate(&state);
+        }
+        for (size_t i = 0 ; i < nValues * nIn ; i++) {
+            u[i] = 0.5 * random_coordinate(&state);
+        }
+
+        ResourceStack resources = ResourceStack__new();
+
+        DelaunayTable* const rows   = from_table(nOut, OutputLayout__table , resources);
+        DelaunayTable* const packed = from_table(nOut, OutputLayout__packed, resources);
+
+        // Rows of wide outputs are aligned and padded, narrow ones are dense
+        assert( rows->outputs == NULL );
+        assert( packed->outputs != NULL );
+        assert( packed->outputStride >= nOut );
+        if (nOut >= 8) {
+            assert( ((uintptr_t) packed->outputs) % 64 == 0 );
+            assert( packed->outputStride % 8 == 0 );
+        } else {
+            assert( packed->outputStride == nOut );
+        }
+
+        // Same values and jacobians as outputs of the table
+        QueryWorkspace* const workspace = ResourceStack__ensure_delete_finally(
+            resources,
+            QueryWorkspace__new(nIn),
+            QueryWorkspace__delete
+        );
+
+        size_t hint     = noPolygon;
+        size_t hint_ref = noPolygon;
+        for (size_t iValue = 0 ; iValue < nValues ; iValue++) {
+            double y        [maxOut];
+            double y_ref    [maxOut];
+            double dy_du    [maxOut * nIn];
+            double dy_du_ref[maxOut * nIn];
+
+            assert( DelaunayTable__get_value_and_jacobian(
+                packed, nIn, nOut, &u[iValue * nIn], y    , dy_du    , &hint    , workspace
+            ) == 0 );
+            assert( DelaunayTable__get_value_and_jacobian(
+                rows  , nIn, nOut, &u[iValue * nIn], y_ref, dy_du_ref, &hint_ref, workspace
+            ) == 0 );
+
+            for (size_t iOut = 0 ; iOut < nOut ; iOut++) {
+                assert( double__compare(y[iOut], y_ref[iOut]) == 0 );
+            }
+            for (size_t i = 0 ; i < nOut * nIn ; i++) {
+                assert( double__compare(dy_du[i], dy_du_ref[i]) == 0 );
+            }
+        }
+
+        ResourceStack__delete(resources);
+    }
+
+    return EXIT_SUCCESS;
+}
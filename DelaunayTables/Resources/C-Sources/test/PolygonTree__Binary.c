@@ -12,49 +12,48 @@ static const size_t nChildren = 2;  // If nChildren is 2, binary tree
 static const size_t nDepth    = 10;
 
 static void make_tree(
-    PolygonTreeVector* const this,
-    PolygonTree* const parent,
-    const size_t depth,
-    const size_t index
+    PolygonTreeVector* const this
 ) {
-    PolygonTree* polygon;
-    assert ( (polygon = PolygonTree__new(nDim)) != NULL );
+    assert ( PolygonTreeVector__append(this, 1) == 0 );
 
     /// nDim must be 1
-    polygon->vertices[0] = depth;
-    polygon->vertices[1] = index;
+    PolygonTreeVector__vertices(this, 0)[0] = nDepth;
+    PolygonTreeVector__vertices(this, 0)[1] = 0;
 
-    assert ( PolygonTreeVector__append(this, polygon) == 0 );
+    // Children are appended in breadth first order
+    for (size_t polygon = 0 ; polygon < (this->size) ; polygon++) {
+        const size_t depth = PolygonTreeVector__vertices(this, polygon)[0];
+        const size_t index = PolygonTreeVector__vertices(this, polygon)[1];
 
-    if (parent) {
-        assert( PolygonTree__append_child(parent, polygon) == 0 );
-    }
+        if (depth == 0) continue;
+
+        const size_t firstChild = this->size;
+        assert ( PolygonTreeVector__append(this, nChildren) == 0 );
 
-    if (depth == 0) return;
+        PolygonTreeVector__set_children(this, polygon, firstChild, nChildren);
 
-    for (size_t i = 0 ; i < nChildren ; i++) {
-        make_tree(
-            this,
-            polygon,
-            depth-1,
-            nChildren * index + i
-        );
+        for (size_t i = 0 ; i < nChildren ; i++) {
+            PolygonTreeVector__vertices(this, firstChild + i)[0] = depth-1;
+            PolygonTreeVector__vertices(this, firstChild + i)[1] = nChildren * index + i;
+        }
     }
 }
 
 static void assert_polygon(
-    const PolygonTree* const polygon
+    const PolygonTreeVector* const this,
+    const size_t polygon
 ) {
-    const size_t depth = polygon->vertices[0];
-    const size_t index = polygon->vertices[1];
+    const size_t depth = PolygonTreeVector__vertices(this, polygon)[0];
+    const size_t index = PolygonTreeVector__vertices(this, polygon)[1];
 
     if (depth == 0) {
-        assert( PolygonTree__nChildren(polygon) == 0 );
+        assert( PolygonTreeVector__nChildren(this, polygon) == 0 );
     } else {
-        assert( PolygonTree__nChildren(polygon) == nChildren );
+        assert( PolygonTreeVector__nChildren(this, polygon) == nChildren );
         for (size_t i = 0 ; i < nChildren ; i++) {
-            assert( PolygonTree__children(polygon)[i]->vertices[0] == depth-1            );
-            assert( PolygonTree__children(polygon)[i]->vertices[1] == nChildren*index + i);
+            const size_t child = PolygonTreeVector__firstChild(this, polygon) + i;
+            assert( PolygonTreeVector__vertices(this, child)[0] == depth-1            );
+            assert( PolygonTreeVector__vertices(this, child)[1] == nChildren*index + i);
         }
     }
 }
@@ -70,19 +69,16 @@ static inline size_t nPolygons() {
 
 int main(int argc, char** argv) {
     PolygonTreeVector* polygons;
-    assert( (polygons = PolygonTreeVector__new(0)) != NULL );
+    assert( (polygons = PolygonTreeVector__new(nDim)) != NULL );
 
-    make_tree(polygons, NULL, nDepth, 0);
+    make_tree(polygons);
 
     assert( polygons->size == nPolygons() );
 
     for (size_t i = 0 ; i < (polygons->size) ; i++) {
-        assert_polygon(
-            PolygonTreeVector__elements(polygons)[i]
-        );
+        assert_polygon(polygons, i);
     }
 
-    PolygonTreeVector__delete_elements(polygons);
     PolygonTreeVector__delete(polygons);
 
     return EXIT_SUCCESS;
@@ -0,0 +1,194 @@
+#include "DelaunayTable.h"
+#include "DelaunayTable.Predicates.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include <float.h>
+#include <assert.h>
+
+
+#define nOut      (1)
+#define maxIn     (3)
+#define maxPoints (216)
+
+static double table[maxPoints * (maxIn + nOut)];
+
+/// deterministic pseudo random number in [-1, +1)
+static double random_coordinate(
+    uint64_t* const state
+) {
+    *state = (*state) * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double) ((*state) >> 11) / (double) (1ULL << 52) - 1.0;
+}
+
+static void check_orientation(
+    uint64_t* const state
+) {
+    for (size_t iCase = 0 ; iCase < 1000 ; iCase++) {
+        const double t[3] = {
+            random_coordinate(state),
+            random_coordinate(state),
+            random_coordinate(state)
+        };
+
+        // Points on the line y = x are exactly collinear
+        const double p0[2] = {t[0], t[0]};
+        const double p1[2] = {t[1], t[1]};
+        double       p2[2] = {t[2], t[2]};
+        const double* points[3] = {p0, p1, p2};
+
+        int sign;
+        assert( Predicates__orientation(2, points, &sign) == 0 );
+        assert( sign == 0 );
+
+        // Next to the line, by one ulp (or two)
+        p2[1] = t[2] + fabs(t[2]) * DBL_EPSILON;
+
+        int expected = (t[1] > t[0]) ? +1 : -1;
+        assert( Predicates__orientation(2, points, &sign) == 0 );
+        assert( sign == expected );
+    }
+}
+
+static void check_insphere(
+    uint64_t* const state
+) {
+    for (size_t iCase = 0 ; iCase < 1000 ; iCase++) {
+        // Cocircular points: a rectangle
+        const double x0 = random_coordinate(state), x1 = x0 + 1.0;
+        const double y0 = random_coordinate(state), y1 = y0 + 0.5;
+
+        const double a[2] = {x0, y0};
+        const double b[2] = {x1, y0};
+        const double c[2] = {x1, y1};
+        const double d[2] = {x0, y1};
+
+        size_t indices[4];
+        for (size_t i = 0 ; i < 4 ; i++) {
+            indices[i] = (size_t) (random_coordinate(state) * 1000.0 + 1000.0) * 4 + i;
+        }
+
+        const double* abc[3] = {a, b, c};
+        const size_t  abc_indices[3] = {indices[0], indices[1], indices[2]};
+        const double* acd[3] = {a, c, d};
+        const size_t  acd_indices[3] = {indices[0], indices[2], indices[3]};
+
+        // Perturbation decides one of the diagonals consistently
+        bool d_in_abc, b_in_acd;
+        assert( Predicates__insphere(2, abc, abc_indices, d, indices[3], &d_in_abc) == 0 );
+        assert( Predicates__insphere(2, acd, acd_indices, b, indices[1], &b_in_acd) == 0 );
+        assert( d_in_abc == b_in_acd );
+
+        // Same as the floating point judgement far from the circumsphere
+        const double center[2] = {(x0 + x1) / 2.0, (y0 + y1) / 2.0};
+        const double far   [2] = {x1 + 1.0, y1 + 1.0};
+
+        bool inside;
+        assert( Predicates__insphere(2, abc, abc_indices, center, 9999, &inside) == 0 );
+        assert( inside );
+        assert( Predicates__insphere(2, abc, abc_indices, far, 9999, &inside) == 0 );
+        assert( !inside );
+    }
+}
+
+static const double* coordinates(
+    const DelaunayTable* const delaunayTable,
+    const size_t iPoint
+) {
+    const size_t nIn = delaunayTable->nIn;
+
+    return (iPoint < delaunayTable->nPoints)
+        ? &delaunayTable->table[iPoint * (nIn + nOut)]
+        : &delaunayTable->table_extended[(iPoint - delaunayTable->nPoints) * nIn];
+}
+
+/// Every face is locally delaunay by exact predicates, and no polygon is flat
+static void check_grid(
+    const size_t nIn,
+    const size_t nGrid,
+    const enum Inserter inserter
+) {
+    size_t nPoints = 1;
+    for (size_t i = 0 ; i < nIn ; i++) {nPoints *= nGrid;}
+
+    for (size_t iPoint = 0 ; iPoint < nPoints ; iPoint++) {
+        double* const row = &table[iPoint * (nIn + nOut)];
+
+        size_t index = iPoint;
+        for (size_t i = 0 ; i < nIn ; i++) {
+            row[i] = (double) (index % nGrid) / (double) (nGrid - 1);
+            index /= nGrid;
+        }
+        row[nIn] = 0.0;
+    }
+
+    DelaunayTableOptions options = DelaunayTableOptions__default();
+    options.inserter = inserter;
+
+    ResourceStack resources = ResourceStack__new();
+
+    const DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+        resources,
+        DelaunayTable__from_buffer(nPoints, nIn, nOut, table, &options, Verbosity__quiet, resources),
+        DelaunayTable__delete
+    );
+
+    const Triangulation* const triangulation = delaunayTable->triangulation;
+
+    const double* shape[maxIn+1];
+
+    for (size_t iPolygon = 0 ; iPolygon < (triangulation->nPolygons) ; iPolygon++) {
+        const size_t* const vertices  = Triangulation__vertices (triangulation, iPolygon);
+        const size_t* const neighbors = Triangulation__neighbors(triangulation, iPolygon);
+
+        for (size_t i = 0 ; i < nVerticesInPolygon(nIn) ; i++) {
+            shape[i] = coordinates(delaunayTable, vertices[i]);
+        }
+
+        int orientation;
+        assert( Predicates__orientation(nIn, shape, &orientation) == 0 );
+        assert( orientation != 0 );
+
+        for (size_t iEx = 0 ; iEx < nVerticesInPolygon(nIn) ; iEx++) {
+            if (neighbors[iEx] == noPolygon) {continue;}
+
+            const size_t* const neighborVertices = Triangulation__vertices(triangulation, neighbors[iEx]);
+
+            size_t opposite = 0;
+            for (size_t i = 0 ; i < nVerticesInPolygon(nIn) ; i++) {
+                bool shared = false;
+                for (size_t j = 0 ; j < nVerticesInPolygon(nIn) ; j++) {
+                    shared = shared || (neighborVertices[i] == vertices[j]);
+                }
+                if (!shared) {opposite = neighborVertices[i];}
+            }
+
+            bool inside;
+            assert( Predicates__insphere(
+                nIn, shape, vertices,
+                coordinates(delaunayTable, opposite), opposite,
+                &inside
+            ) == 0 );
+            assert( !inside );
+        }
+    }
+
+    ResourceStack__delete(resources);
+}
+
+int main(int argc, char** argv) {
+    uint64_t state = 11;
+
+    check_orientation(&state);
+    check_insphere(&state);
+
+    check_grid(2, 8, Inserter__cavity);
+    check_grid(2, 8, Inserter__flip);
+    check_grid(3, 6, Inserter__cavity);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,84 @@
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+
+
+#define nOut       (2)
+#define maxIn      (3)
+#define maxPoints  (500)
+#define nValues    (2000)
+
+static double table[maxPoints * (maxIn + nOut)];
+static double u    [nValues * maxIn];
+static double y    [nValues * nOut];
+static int    statuses[nValues];
+
+/// deterministic pseudo random number in [-1, +1)
+static double random_coordinate(
+    uint64_t* const state
+) {
+    *state = (*state) * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double) ((*state) >> 11) / (double) (1ULL << 52) - 1.0;
+}
+
+int main(int argc, char** argv) {
+    const size_t nIns    [] = {1  , 2  , 3  };
+    const size_t nPointss[] = {100, 500, 300};
+
+    for (size_t iCase = 0 ; iCase < 3 ; iCase++) {
+        const size_t nIn     = nIns    [iCase];
+        const size_t nPoints = nPointss[iCase];
+
+        uint64_t state = 9;
+        for (size_t i = 0 ; i < nPoints * (nIn + nOut) ; i++) {
+            table[i] = random_coordinate(&state);
+        }
+
+        // Some of inputs are outside of the convex hull
+        for (size_t i = 0 ; i < nValues * nIn ; i++) {
+            u[i] = 1.1 * random_coordinate(&state);
+        }
+
+        ResourceStack resources = ResourceStack__new();
+
+        DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+            resources,
+            DelaunayTable__from_buffer(nPoints, nIn, nOut, table, NULL, Verbosity__quiet, resources),
+            DelaunayTable__delete
+        );
+
+        const int status = DelaunayTable__get_values(delaunayTable, nIn, nOut, nValues, u, y, statuses);
+
+        // Same as queries one by one, in the original order
+        size_t nFailed = 0;
+        for (size_t iValue = 0 ; iValue < nValues ; iValue++) {
+            double y_ref[nOut];
+            const int status_ref = DelaunayTable__get_value(delaunayTable, nIn, nOut, &u[iValue * nIn], y_ref);
+
+            assert( statuses[iValue] == status_ref );
+            if (status_ref) {nFailed++; continue;}
+
+            for (size_t iOut = 0 ; iOut < nOut ; iOut++) {
+                assert( double__compare(y[iValue * nOut + iOut], y_ref[iOut]) == 0 );
+            }
+        }
+
+        assert( nFailed > 0 && nFailed < nValues );
+        assert( status != 0 );
+
+        // Without statuses, succeeds if all inputs are inside
+        for (size_t i = 0 ; i < nValues * nIn ; i++) {
+            u[i] = table[(i / nIn) % nPoints * (nIn + nOut) + i % nIn];
+        }
+        assert( DelaunayTable__get_values(delaunayTable, nIn, nOut, nValues, u, y, NULL) == 0 );
+        assert( DelaunayTable__get_values(delaunayTable, nIn, nOut, 0, u, y, NULL) == 0 );
+        assert( DelaunayTable__get_values(delaunayTable, nIn + 1, nOut, nValues, u, y, NULL) != 0 );
+
+        ResourceStack__delete(resources);
+    }
+
+    return EXIT_SUCCESS;
+}
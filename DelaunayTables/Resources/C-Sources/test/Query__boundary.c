@@ -0,0 +1,111 @@
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+
+
+#define nOut       (1)
+#define maxIn      (4)
+#define maxPoints  (400)
+#define nValues    (2000)
+
+static double table[maxPoints * (maxIn + nOut)];
+static double u    [nValues * maxIn];
+
+/// deterministic pseudo random number in [-1, +1)
+static double random_coordinate(
+    uint64_t* const state
+) {
+    *state = (*state) * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double) ((*state) >> 11) / (double) (1ULL << 52) - 1.0;
+}
+
+/// Output of the table, interpolation of a linear function is exact
+static double linear(
+    const size_t nIn,
+    const double* const coordinates
+) {
+    double y = 0.5;
+    for (size_t i = 0 ; i < nIn ; i++) {
+        y += (double) (i + 1) * coordinates[i];
+    }
+    return y;
+}
+
+int main(int argc, char** argv) {
+    const size_t nIns    [] = {2  , 3  , 4  };
+    const size_t nPointss[] = {400, 300, 200};
+
+    for (size_t iCase = 0 ; iCase < 3 ; iCase++) {
+        const size_t nIn     = nIns    [iCase];
+        const size_t nPoints = nPointss[iCase];
+
+        // Corners and points on faces of [-1, +1]^nIn, then points inside
+        uint64_t state = 23;
+        const size_t nCorners = (size_t) 1 << nIn;
+        for (size_t iPoint = 0 ; iPoint < nPoints ; iPoint++) {
+            double* const row = &table[iPoint * (nIn + nOut)];
+            for (size_t i = 0 ; i < nIn ; i++) {
+                row[i] = (iPoint < nCorners)
+                    ? (((iPoint >> i) & 1) ? +1.0 : -1.0)
+                    : random_coordinate(&state);
+            }
+            if (nCorners <= iPoint && iPoint < nPoints / 2) {
+                row[iPoint % nIn] = (row[iPoint % nIn] < 0.0) ? -1.0 : +1.0;
+            }
+            row[nIn] = linear(nIn, row);
+        }
+
+        // Inputs on faces of the convex hull
+        for (size_t iValue = 0 ; iValue < nValues ; iValue++) {
+            for (size_t i = 0 ; i < nIn ; i++) {
+                u[iValue * nIn + i] = 0.99 * random_coordinate(&state);
+            }
+            double* const onFace = &u[iValue * nIn + iValue % nIn];
+            *onFace = (*onFace < 0.0) ? -1.0 : +1.0;
+        }
+
+        ResourceStack resources = ResourceStack__new();
+
+        DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+            resources,
+            DelaunayTable__from_buffer(nPoints, nIn, nOut, table, NULL, Verbosity__quiet, resources),
+            DelaunayTable__delete
+        );
+
+        // Hull neighbors share the face opposite to the extended vertex
+        const Triangulation* const triangulation = delaunayTable->triangulation;
+        size_t nHullNeighbors = 0;
+        for (size_t iPolygon = 0 ; iPolygon < (triangulation->nPolygons) ; iPolygon++) {
+            const size_t hullNeighbor = triangulation->hullNeighbors[iPolygon];
+            if (hullNeighbor == noPolygon) {continue;}
+            nHullNeighbors++;
+
+            const size_t* const vertices         = Triangulation__vertices(triangulation, iPolygon);
+            const size_t* const neighborVertices = Triangulation__vertices(triangulation, hullNeighbor);
+            assert( vertices[nIn] >= nPoints && neighborVertices[nIn] < nPoints );
+            for (size_t i = 0 ; i < nIn ; i++) {
+                bool shared = false;
+                for (size_t j = 0 ; j < nVerticesInPolygon(nIn) ; j++) {
+                    shared = shared || (neighborVertices[j] == vertices[i]);
+                }
+                assert( shared );
+            }
+        }
+        assert( nHullNeighbors > 0 );
+
+        // All inputs on the hull are interpolated exactly
+        for (size_t iValue = 0 ; iValue < nValues ; iValue++) {
+            double y;
+            assert( DelaunayTable__get_value(delaunayTable, nIn, nOut, &u[iValue * nIn], &y) == 0 );
+            assert( double__compare(y, linear(nIn, &u[iValue * nIn])) == 0 );
+        }
+
+        ResourceStack__delete(resources);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,98 @@
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+
+
+#define nOut       (2)
+#define maxIn      (4)
+#define maxPoints  (500)
+#define nValues    (2000)
+
+static double table[maxPoints * (maxIn + nOut)];
+static double u    [nValues * maxIn];
+
+/// deterministic pseudo random number in [-1, +1)
+static double random_coordinate(
+    uint64_t* const state
+) {
+    *state = (*state) * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double) ((*state) >> 11) / (double) (1ULL << 52) - 1.0;
+}
+
+static DelaunayTable* from_table(
+    const size_t nIn,
+    const size_t nPoints,
+    const enum QueryIndex queryIndex,
+    ResourceStack resources
+) {
+    DelaunayTableOptions options = DelaunayTableOptions__default();
+    options.queryIndex = queryIndex;
+
+    return ResourceStack__ensure_delete_finally(
+        resources,
+        DelaunayTable__from_buffer(nPoints, nIn, nOut, table, &options, Verbosity__quiet, resources),
+        DelaunayTable__delete
+    );
+}
+
+int main(int argc, char** argv) {
+    const size_t nIns    [] = {1  , 2  , 3  , 4  };
+    const size_t nPointss[] = {100, 500, 300, 100};
+
+    for (size_t iCase = 0 ; iCase < 4 ; iCase++) {
+        const size_t nIn     = nIns    [iCase];
+        const size_t nPoints = nPointss[iCase];
+
+        uint64_t state = 19;
+        for (size_t i = 0 ; i < nPoints * (nIn + nOut) ; i++) {
+            table[i] = random_coordinate(&state);
+        }
+
+        // Some of inputs are outside of the grid
+        for (size_t i = 0 ; i < nValues * nIn ; i++) {
+            u[i] = 1.2 * random_coordinate(&state);
+        }
+
+        ResourceStack resources = ResourceStack__new();
+
+        DelaunayTable* const jump = from_table(nIn, nPoints, QueryIndex__jump, resources);
+        DelaunayTable* const grid = from_table(nIn, nPoints, QueryIndex__grid, resources);
+
+        const Triangulation* const triangulation = grid->triangulation;
+        assert( jump->triangulation->nGridCells == 0 );
+        assert( triangulation->nGridCells > 0 );
+
+        // Centers of all cells are located (the triangulation covers the bounding box)
+        size_t nAllCells = 1;
+        for (size_t i = 0 ; i < nIn ; i++) {
+            nAllCells *= triangulation->nGridCells;
+        }
+        for (size_t iCell = 0 ; iCell < nAllCells ; iCell++) {
+            assert( triangulation->gridPolygons[iCell] < triangulation->nPolygons );
+        }
+
+        // Same results as jump & walk
+        size_t nFailed = 0;
+        for (size_t iValue = 0 ; iValue < nValues ; iValue++) {
+            double y    [nOut];
+            double y_ref[nOut];
+            const int status     = DelaunayTable__get_value(grid, nIn, nOut, &u[iValue * nIn], y);
+            const int status_ref = DelaunayTable__get_value(jump, nIn, nOut, &u[iValue * nIn], y_ref);
+
+            assert( status == status_ref );
+            if (status) {nFailed++; continue;}
+
+            for (size_t iOut = 0 ; iOut < nOut ; iOut++) {
+                assert( double__compare(y[iOut], y_ref[iOut]) == 0 );
+            }
+        }
+        assert( nFailed > 0 && nFailed < nValues );
+
+        ResourceStack__delete(resources);
+    }
+
+    return EXIT_SUCCESS;
+}
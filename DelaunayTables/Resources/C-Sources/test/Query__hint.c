@@ -0,0 +1,93 @@
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+
+
+#define nOut       (2)
+#define maxIn      (3)
+#define maxPoints  (500)
+#define nSteps     (2000)
+
+static double table[maxPoints * (maxIn + nOut)];
+
+/// deterministic pseudo random number in [-1, +1)
+static double random_coordinate(
+    uint64_t* const state
+) {
+    *state = (*state) * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double) ((*state) >> 11) / (double) (1ULL << 52) - 1.0;
+}
+
+int main(int argc, char** argv) {
+    const size_t nIns    [] = {1  , 2  , 3  };
+    const size_t nPointss[] = {100, 500, 300};
+
+    for (size_t iCase = 0 ; iCase < 3 ; iCase++) {
+        const size_t nIn     = nIns    [iCase];
+        const size_t nPoints = nPointss[iCase];
+
+        uint64_t state = 13;
+        for (size_t i = 0 ; i < nPoints * (nIn + nOut) ; i++) {
+            table[i] = random_coordinate(&state);
+        }
+
+        ResourceStack resources = ResourceStack__new();
+
+        DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+            resources,
+            DelaunayTable__from_buffer(nPoints, nIn, nOut, table, NULL, Verbosity__quiet, resources),
+            DelaunayTable__delete
+        );
+
+        // A random walk leaving and entering the convex hull, like inputs of time steps
+        size_t hint = noPolygon;
+        size_t nFailed = 0;
+
+        double u[maxIn] = {0.0};
+
+        for (size_t iStep = 0 ; iStep < nSteps ; iStep++) {
+            for (size_t i = 0 ; i < nIn ; i++) {
+                u[i] += 0.05 * random_coordinate(&state);
+                if (u[i] > +1.2) {u[i] = +2.4 - u[i];}
+                if (u[i] < -1.2) {u[i] = -2.4 - u[i];}
+            }
+
+            double y    [nOut];
+            double y_ref[nOut];
+            const int status     = DelaunayTable__get_value_from_hint(delaunayTable, nIn, nOut, u, y, &hint);
+            const int status_ref = DelaunayTable__get_value          (delaunayTable, nIn, nOut, u, y_ref);
+
+            assert( status == status_ref );
+            if (status) {
+                nFailed++;
+                assert( hint == noPolygon );
+                continue;
+            }
+
+            assert( hint < delaunayTable->triangulation->nPolygons );
+            for (size_t iOut = 0 ; iOut < nOut ; iOut++) {
+                assert( double__compare(y[iOut], y_ref[iOut]) == 0 );
+            }
+
+            // The hint is the polygon containing u, walks from it take no step
+            double y_again[nOut];
+            const size_t previousHint = hint;
+            assert( DelaunayTable__get_value_from_hint(delaunayTable, nIn, nOut, u, y_again, &hint) == 0 );
+            assert( hint == previousHint );
+
+            // Invalid hints are ignored
+            size_t invalidHint = delaunayTable->triangulation->nPolygons;
+            assert( DelaunayTable__get_value_from_hint(delaunayTable, nIn, nOut, u, y_again, &invalidHint) == 0 );
+            assert( invalidHint < delaunayTable->triangulation->nPolygons );
+        }
+
+        assert( nFailed > 0 && nFailed < nSteps );
+
+        ResourceStack__delete(resources);
+    }
+
+    return EXIT_SUCCESS;
+}
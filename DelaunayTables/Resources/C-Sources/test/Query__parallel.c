@@ -0,0 +1,101 @@
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+
+
+#define nOut       (2)
+#define maxIn      (3)
+#define maxPoints  (500)
+#define nValues    (5000)
+
+static double table[maxPoints * (maxIn + nOut)];
+static double u    [nValues * maxIn];
+static double y    [nValues * nOut];
+static double y_ref[nValues * nOut];
+static int    statuses    [nValues];
+static int    statuses_ref[nValues];
+
+/// deterministic pseudo random number in [-1, +1)
+static double random_coordinate(
+    uint64_t* const state
+) {
+    *state = (*state) * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double) ((*state) >> 11) / (double) (1ULL << 52) - 1.0;
+}
+
+static void assert_same_values(
+    const size_t nIn
+) {
+    for (size_t iValue = 0 ; iValue < nValues ; iValue++) {
+        assert( statuses[iValue] == statuses_ref[iValue] );
+        if (statuses_ref[iValue]) {continue;}
+
+        for (size_t iOut = 0 ; iOut < nOut ; iOut++) {
+            assert( double__compare(y[iValue * nOut + iOut], y_ref[iValue * nOut + iOut]) == 0 );
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    const size_t nIns    [] = {1  , 2  , 3  };
+    const size_t nPointss[] = {100, 500, 300};
+    const size_t nThreadss[] = {0, 1, 2, 4, 7};
+
+    for (size_t iCase = 0 ; iCase < 3 ; iCase++) {
+        const size_t nIn     = nIns    [iCase];
+        const size_t nPoints = nPointss[iCase];
+
+        uint64_t state = 11;
+        for (size_t i = 0 ; i < nPoints * (nIn + nOut) ; i++) {
+            table[i] = random_coordinate(&state);
+        }
+
+        // Some of inputs are outside of the convex hull
+        for (size_t i = 0 ; i < nValues * nIn ; i++) {
+            u[i] = 1.1 * random_coordinate(&state);
+        }
+
+        ResourceStack resources = ResourceStack__new();
+
+        DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+            resources,
+            DelaunayTable__from_buffer(nPoints, nIn, nOut, table, NULL, Verbosity__quiet, resources),
+            DelaunayTable__delete
+        );
+
+        for (size_t iValue = 0 ; iValue < nValues ; iValue++) {
+            statuses_ref[iValue] = DelaunayTable__get_value(
+                delaunayTable, nIn, nOut, &u[iValue * nIn], &y_ref[iValue * nOut]
+            );
+        }
+
+        // Same as queries one by one for any number of threads
+        for (size_t iThreads = 0 ; iThreads < 5 ; iThreads++) {
+            const int status = DelaunayTable__get_values_parallel(
+                delaunayTable, nIn, nOut, nValues, u, y, statuses, nThreadss[iThreads]
+            );
+            assert( status != 0 );
+            assert_same_values(nIn);
+        }
+
+        // Concurrent callers of get_value share the table
+        const long nValues_long = nValues;
+        #pragma omp parallel for num_threads(4) schedule(dynamic, 64)
+        for (long iValue = 0 ; iValue < nValues_long ; iValue++) {
+            statuses[iValue] = DelaunayTable__get_value(
+                delaunayTable, nIn, nOut, &u[iValue * nIn], &y[iValue * nOut]
+            );
+        }
+        assert_same_values(nIn);
+
+        assert( DelaunayTable__get_values_parallel(delaunayTable, nIn, nOut, 0, u, y, NULL, 4) == 0 );
+        assert( DelaunayTable__get_values_parallel(delaunayTable, nIn, nOut + 1, nValues, u, y, NULL, 4) != 0 );
+
+        ResourceStack__delete(resources);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,107 @@
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+
+
+#define nOut       (2)
+#define maxIn      (4)
+#define maxPoints  (500)
+
+static double table[maxPoints * (maxIn + nOut)];
+
+/// deterministic pseudo random number in [-1, +1)
+static double random_coordinate(
+    uint64_t* const state
+) {
+    *state = (*state) * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double) ((*state) >> 11) / (double) (1ULL << 52) - 1.0;
+}
+
+static DelaunayTable* from_table(
+    const size_t nIn,
+    const size_t nPoints,
+    const enum Query query,
+    ResourceStack resources
+) {
+    DelaunayTableOptions options = DelaunayTableOptions__default();
+    options.query = query;
+
+    return ResourceStack__ensure_delete_finally(
+        resources,
+        DelaunayTable__from_buffer(nPoints, nIn, nOut, table, &options, Verbosity__quiet, resources),
+        DelaunayTable__delete
+    );
+}
+
+int main(int argc, char** argv) {
+    const size_t nIns    [] = {1  , 2  , 3  , 4  };
+    const size_t nPointss[] = {100, 500, 300, 150};
+
+    for (size_t iCase = 0 ; iCase < 4 ; iCase++) {
+        const size_t nIn     = nIns    [iCase];
+        const size_t nPoints = nPointss[iCase];
+
+        // Outputs are linear, interpolation is exact
+        uint64_t state = 3;
+        for (size_t iPoint = 0 ; iPoint < nPoints ; iPoint++) {
+            double* const row = &table[iPoint * (nIn + nOut)];
+            for (size_t i = 0 ; i < nIn ; i++) {
+                row[i] = random_coordinate(&state);
+            }
+            for (size_t iOut = 0 ; iOut < nOut ; iOut++) {
+                row[nIn + iOut] = (double) iOut;
+                for (size_t i = 0 ; i < nIn ; i++) {
+                    row[nIn + iOut] += (double) (i + iOut + 1) * row[i];
+                }
+            }
+        }
+
+        ResourceStack resources = ResourceStack__new();
+
+        DelaunayTable* const solve       = from_table(nIn, nPoints, Query__solve      , resources);
+        DelaunayTable* const precomputed = from_table(nIn, nPoints, Query__precomputed, resources);
+
+        assert( solve->triangulation->transforms == NULL );
+        assert( precomputed->triangulation->transforms != NULL );
+
+        // Points and midpoints of table are inside the convex hull
+        for (size_t iPoint = 0 ; iPoint < nPoints ; iPoint++) {
+            const double* const row0 = &table[iPoint * (nIn + nOut)];
+            const double* const row1 = &table[((iPoint * 7 + 1) % nPoints) * (nIn + nOut)];
+
+            double us[2][maxIn];
+            for (size_t i = 0 ; i < nIn ; i++) {
+                us[0][i] = row0[i];
+                us[1][i] = 0.5 * (row0[i] + row1[i]);
+            }
+
+            for (size_t iU = 0 ; iU < 2 ; iU++) {
+                double y    [nOut];
+                double y_ref[nOut];
+                const int status_ref = DelaunayTable__get_value(solve      , nIn, nOut, us[iU], y_ref);
+                const int status     = DelaunayTable__get_value(precomputed, nIn, nOut, us[iU], y    );
+
+                // Both succeed except near the boundary covered by polygons of extended points
+                assert( status == status_ref );
+                if (status) {continue;}
+
+                for (size_t iOut = 0 ; iOut < nOut ; iOut++) {
+                    assert( double__compare(y[iOut], y_ref[iOut]) == 0 );
+                }
+            }
+        }
+
+        // Outside of the convex hull
+        double u[maxIn] = {0.0};
+        u[0] = 1.5;
+        double y[nOut];
+        assert( DelaunayTable__get_value(precomputed, nIn, nOut, u, y) != 0 );
+
+        ResourceStack__delete(resources);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,151 @@
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <assert.h>
+
+
+#define nOut       (1)
+#define maxIn      (7)
+#define maxPoints  (300)
+#define nValues    (1000)
+
+static double table[maxPoints * (maxIn + nOut)];
+static double u    [(nValues + maxPoints) * maxIn];
+
+
+/**
+ * Heap allocations of the process are counted by interposing `malloc` of glibc,
+ * elsewhere `nAllocations` stays 0 and only values are checked.
+ */
+static size_t nAllocations = 0;
+
+#if defined(__GLIBC__)
+extern void* __libc_malloc (size_t size);
+extern void* __libc_calloc (size_t n, size_t size);
+extern void* __libc_realloc(void* p, size_t size);
+
+void* malloc(size_t size) {
+    nAllocations++;
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t n, size_t size) {
+    nAllocations++;
+    return __libc_calloc(n, size);
+}
+
+void* realloc(void* p, size_t size) {
+    nAllocations++;
+    return __libc_realloc(p, size);
+}
+#endif
+
+
+/// deterministic pseudo random number in [-1, +1)
+static double random_coordinate(
+    uint64_t* const state
+) {
+    *state = (*state) * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double) ((*state) >> 11) / (double) (1ULL << 52) - 1.0;
+}
+
+static void query_all(
+    DelaunayTable* const delaunayTable,
+    QueryWorkspace* const workspace,
+    const size_t nIn,
+    const size_t nInputs  // random inputs (`nValues`) followed by points of table
+) {
+    size_t hint = noPolygon;
+
+    for (size_t iValue = 0 ; iValue < nInputs ; iValue++) {
+        double y;
+        double y_ref;
+        const int status     = DelaunayTable__get_value_in_workspace(
+            delaunayTable, nIn, nOut, &u[iValue * nIn], &y, &hint, workspace
+        );
+
+        const size_t nAllocationsBefore = nAllocations;
+        const int status_ref = DelaunayTable__get_value(delaunayTable, nIn, nOut, &u[iValue * nIn], &y_ref);
+#if defined(__GLIBC__)
+        // get_value keeps its workspace on the stack, only vectors for inputs on faces are allocated
+        if (iValue < nValues) {
+            assert( nAllocations == nAllocationsBefore );
+        }
+#endif
+        nAllocations = nAllocationsBefore;
+
+        assert( status == status_ref );
+        if (!status) {
+            assert( double__compare(y, y_ref) == 0 );
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    const size_t     nIns    [] = {1  , 2  , 2                 , 3  , 7 };
+    const size_t     nPointss[] = {100, 300, 300               , 200, 30};
+    const enum Query queries [] = {Query__solve, Query__solve, Query__precomputed, Query__solve, Query__solve};
+
+    for (size_t iCase = 0 ; iCase < 5 ; iCase++) {
+        const size_t nIn     = nIns    [iCase];
+        const size_t nPoints = nPointss[iCase];
+
+        uint64_t state = 17;
+        for (size_t i = 0 ; i < nPoints * (nIn + nOut) ; i++) {
+            table[i] = random_coordinate(&state);
+        }
+
+        // Random inputs (some outside of the convex hull), and points of table (some on faces of the hull)
+        for (size_t i = 0 ; i < nValues * nIn ; i++) {
+            u[i] = 1.1 * random_coordinate(&state);
+        }
+        for (size_t iPoint = 0 ; iPoint < nPoints ; iPoint++) {
+            for (size_t i = 0 ; i < nIn ; i++) {
+                u[(nValues + iPoint) * nIn + i] = table[iPoint * (nIn + nOut) + i];
+            }
+        }
+        const size_t nInputs = nValues + nPoints;
+
+        ResourceStack resources = ResourceStack__new();
+
+        DelaunayTableOptions options = DelaunayTableOptions__default();
+        options.query = queries[iCase];
+
+        DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+            resources,
+            DelaunayTable__from_buffer(nPoints, nIn, nOut, table, &options, Verbosity__quiet, resources),
+            DelaunayTable__delete
+        );
+
+        QueryWorkspace* const workspace = ResourceStack__ensure_delete_finally(
+            resources,
+            QueryWorkspace__new(nIn),
+            QueryWorkspace__delete
+        );
+
+        // Vectors of the workspace grow in the first pass
+        query_all(delaunayTable, workspace, nIn, nInputs);
+
+        // Steady state: no allocation
+        nAllocations = 0;
+        query_all(delaunayTable, workspace, nIn, nInputs);
+        assert( nAllocations == 0 );
+
+        // Workspaces of other dimensions are rejected
+        QueryWorkspace* const otherWorkspace = ResourceStack__ensure_delete_finally(
+            resources,
+            QueryWorkspace__new(nIn + 1),
+            QueryWorkspace__delete
+        );
+        size_t hint = noPolygon;
+        double y;
+        assert( DelaunayTable__get_value_in_workspace(delaunayTable, nIn, nOut, u, &y, &hint, otherWorkspace) != 0 );
+
+        ResourceStack__delete(resources);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -37,7 +37,7 @@ int main(int argc, char** argv) {
 
     DelaunayTable* delaunayTable = ResourceStack__ensure_delete_finally(
         resources,
-        DelaunayTable__from_buffer(nPoints, nIn, nOut, table, Verbosity__detail, resources),
+        DelaunayTable__from_buffer(nPoints, nIn, nOut, table, NULL, Verbosity__detail, resources),
         DelaunayTable__delete
     );
 
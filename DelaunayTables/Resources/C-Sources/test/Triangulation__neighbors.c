@@ -0,0 +1,105 @@
+#include "DelaunayTable.h"
+#include "DelaunayTable.ResourceStack.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+
+
+#define nIn     (2)
+#define nOut    (1)
+#define nPoints (300)
+
+static double table[nPoints * (nIn + nOut)];
+
+/// deterministic pseudo random number in [-1, +1)
+static double random_coordinate(
+    uint64_t* const state
+) {
+    *state = (*state) * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double) ((*state) >> 11) / (double) (1ULL << 52) - 1.0;
+}
+
+static bool contains(
+    const size_t* const vertices,
+    const size_t vertex
+) {
+    for (size_t i = 0 ; i < nVerticesInPolygon(nIn) ; i++) {
+        if (vertices[i] == vertex) {return true;}
+    }
+    return false;
+}
+
+int main(int argc, char** argv) {
+    uint64_t state = 3;
+
+    for (size_t iPoint = 0 ; iPoint < nPoints ; iPoint++) {
+        double* const row = &table[iPoint * (nIn + nOut)];
+        row[0] = random_coordinate(&state);
+        row[1] = random_coordinate(&state);
+        row[2] = 0.0;
+    }
+
+    ResourceStack resources = ResourceStack__new();
+
+    DelaunayTable* const delaunayTable = ResourceStack__ensure_delete_finally(
+        resources,
+        DelaunayTable__from_buffer(nPoints, nIn, nOut, table, NULL, Verbosity__quiet, resources),
+        DelaunayTable__delete
+    );
+
+    const Triangulation* const triangulation = delaunayTable->triangulation;
+
+    for (size_t iPolygon = 0 ; iPolygon < (triangulation->nPolygons) ; iPolygon++) {
+        const size_t* const vertices  = Triangulation__vertices (triangulation, iPolygon);
+        const size_t* const neighbors = Triangulation__neighbors(triangulation, iPolygon);
+
+        // Neighbors share faces each other
+        for (size_t iEx = 0 ; iEx < nVerticesInPolygon(nIn) ; iEx++) {
+            if (neighbors[iEx] == noPolygon) {
+                // Only faces of extended points are on the outer boundary
+                for (size_t i = 0 ; i < nVerticesInPolygon(nIn) ; i++) {
+                    assert( i == iEx || vertices[i] >= nPoints );
+                }
+                continue;
+            }
+
+            const size_t* const neighborVertices  = Triangulation__vertices (triangulation, neighbors[iEx]);
+            const size_t* const neighborNeighbors = Triangulation__neighbors(triangulation, neighbors[iEx]);
+
+            size_t nShared = 0;
+            for (size_t i = 0 ; i < nVerticesInPolygon(nIn) ; i++) {
+                if (i == iEx) {continue;}
+                assert( contains(neighborVertices, vertices[i]) );
+                nShared++;
+            }
+            assert( nShared == nVerticesInFace(nIn) );
+            assert( !contains(neighborVertices, vertices[iEx]) );
+            assert( contains(neighborNeighbors, iPolygon) );
+        }
+
+        // Delaunay: no point of table is inside of the circumsphere
+        bool onTable = true;
+        for (size_t i = 0 ; i < nVerticesInPolygon(nIn) ; i++) {
+            onTable = onTable && (vertices[i] < nPoints);
+        }
+        if (!onTable) {continue;}
+
+        const double* shape[nVerticesInPolygon(nIn)];
+        for (size_t i = 0 ; i < nVerticesInPolygon(nIn) ; i++) {
+            shape[i] = &table[vertices[i] * (nIn + nOut)];
+        }
+
+        for (size_t iPoint = 0 ; iPoint < nPoints ; iPoint++) {
+            if (contains(vertices, iPoint)) {continue;}
+
+            bool inside;
+            assert( insideCircumsphereOfPolygon(nIn, shape, &table[iPoint * (nIn + nOut)], &inside) == 0 );
+            assert( !inside );
+        }
+    }
+
+    ResourceStack__delete(resources);
+    return EXIT_SUCCESS;
+}